@@ -0,0 +1,54 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Driver.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace ec {
+    std::vector<CircuitPair> readManifest(std::istream& is, const std::string& name) {
+        std::vector<CircuitPair> pairs{};
+        std::string              line{};
+        std::size_t              lineNumber = 0U;
+        while (std::getline(is, line)) {
+            ++lineNumber;
+            std::istringstream iss(line);
+            std::string        file1{};
+            std::string        file2{};
+            if (!(iss >> file1) || file1.front() == '#') {
+                continue;
+            }
+            std::string rest{};
+            if (!(iss >> file2) || (iss >> rest)) {
+                throw std::runtime_error("Malformed line " + std::to_string(lineNumber) + " in manifest file " + name + ". Expected exactly two circuit files.");
+            }
+            pairs.push_back({pairs.size(), file1, file2});
+        }
+        return pairs;
+    }
+
+    std::vector<CircuitPair> readManifest(const std::string& filename) {
+        std::ifstream ifs(filename);
+        if (!ifs.good()) {
+            throw std::runtime_error("Could not open manifest file " + filename);
+        }
+        return readManifest(ifs, filename);
+    }
+
+    nlohmann::json formatResult(const CircuitPair& pair, double loadTime, const nlohmann::json& result, const std::string& error) {
+        auto j = result;
+        if (!error.empty()) {
+            j["error"] = error;
+        }
+        auto& description        = j["pair"];
+        description["index"]     = pair.index;
+        description["circuit1"]  = pair.file1;
+        description["circuit2"]  = pair.file2;
+        description["load_time"] = loadTime;
+        return j;
+    }
+} // namespace ec
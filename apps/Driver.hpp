@@ -0,0 +1,31 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace ec {
+    // a pair of circuit files to be checked by the command-line driver
+    struct CircuitPair {
+        std::size_t index{};
+        std::string file1{};
+        std::string file2{};
+    };
+
+    // A manifest lists one pair of circuit files per line (separated by whitespace). Empty lines and lines starting with '#'
+    // are ignored. Pairs are numbered in the order they appear. `name` is only used in error messages.
+    std::vector<CircuitPair> readManifest(std::istream& is, const std::string& name);
+    std::vector<CircuitPair> readManifest(const std::string& filename);
+
+    // The JSON object that is reported for a pair: the result of `EquivalenceCheckingManager::json()` (or an "error" entry
+    // if the pair could not be checked) together with a description of the pair. It is written as a single line.
+    nlohmann::json formatResult(const CircuitPair& pair, double loadTime, const nlohmann::json& result, const std::string& error = "");
+} // namespace ec
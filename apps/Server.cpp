@@ -0,0 +1,380 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Server.hpp"
+
+#include "EquivalenceCheckingManager.hpp"
+#include "PreprocessedPair.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace ec {
+    namespace {
+        qc::Format formatFromString(const std::string& format) {
+            if (format == "qasm" || format == "openqasm") {
+                return qc::OpenQASM;
+            }
+            if (format == "real") {
+                return qc::Real;
+            }
+            if (format == "grcs") {
+                return qc::GRCS;
+            }
+            if (format == "tfc") {
+                return qc::TFC;
+            }
+            if (format == "qc") {
+                return qc::QC;
+            }
+            throw std::invalid_argument("Unknown circuit format " + format + ".");
+        }
+
+        qc::QuantumComputation parseCircuit(const std::string& source, const std::string& format) {
+            qc::QuantumComputation qc{};
+            std::istringstream     iss(source);
+            qc.import(iss, formatFromString(format));
+            return qc;
+        }
+
+        constexpr std::string_view BASE64_ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    } // namespace
+
+    std::string base64Encode(const std::string& data) {
+        std::string encoded{};
+        encoded.reserve((data.size() + 2U) / 3U * 4U);
+        for (std::size_t i = 0U; i < data.size(); i += 3U) {
+            const auto remaining = std::min<std::size_t>(3U, data.size() - i);
+            std::uint32_t block  = 0U;
+            for (std::size_t j = 0U; j < 3U; ++j) {
+                block <<= 8U;
+                if (j < remaining) {
+                    block |= static_cast<std::uint8_t>(data[i + j]);
+                }
+            }
+            for (std::size_t j = 0U; j < 4U; ++j) {
+                encoded += j <= remaining ? BASE64_ALPHABET[(block >> (18U - 6U * j)) & 0x3FU] : '=';
+            }
+        }
+        return encoded;
+    }
+
+    std::string base64Decode(const std::string& encoded) {
+        std::array<std::int8_t, 256U> values{};
+        values.fill(-1);
+        for (std::size_t i = 0U; i < BASE64_ALPHABET.size(); ++i) {
+            values[static_cast<std::uint8_t>(BASE64_ALPHABET[i])] = static_cast<std::int8_t>(i);
+        }
+
+        if (encoded.size() % 4U != 0U) {
+            throw std::invalid_argument("Invalid base64 encoding: length is not a multiple of 4.");
+        }
+        std::string decoded{};
+        decoded.reserve(encoded.size() / 4U * 3U);
+        for (std::size_t i = 0U; i < encoded.size(); i += 4U) {
+            std::uint32_t block   = 0U;
+            std::size_t   padding = 0U;
+            for (std::size_t j = 0U; j < 4U; ++j) {
+                const auto c = encoded[i + j];
+                block <<= 6U;
+                if (c == '=' && i + 4U == encoded.size() && j >= 2U) {
+                    ++padding;
+                    continue;
+                }
+                const auto value = values[static_cast<std::uint8_t>(c)];
+                if (value < 0 || padding > 0U) {
+                    throw std::invalid_argument("Invalid base64 encoding: unexpected character.");
+                }
+                block |= static_cast<std::uint32_t>(value);
+            }
+            for (std::size_t j = 0U; j < 3U - padding; ++j) {
+                decoded += static_cast<char>((block >> (16U - 8U * j)) & 0xFFU);
+            }
+        }
+        return decoded;
+    }
+
+    Server::Server(Options options, Configuration defaults):
+        options(std::move(options)), defaults(std::move(defaults)) {}
+
+    Server::~Server() {
+        stop();
+    }
+
+#ifdef _WIN32
+    Server::Client::~Client() = default;
+    void Server::Client::send(const nlohmann::json&) {}
+    void Server::listen() {}
+    void Server::serve(const std::shared_ptr<Client>&) {}
+
+    void Server::run() {
+        throw std::runtime_error("The verification server is only supported on POSIX systems.");
+    }
+#else
+    Server::Client::~Client() {
+        ::close(fd);
+    }
+
+    void Server::Client::send(const nlohmann::json& response) {
+        const auto      message = response.dump() + "\n";
+        std::lock_guard writeLock(writeMutex);
+        std::size_t     written = 0U;
+        while (written < message.size()) {
+#ifdef MSG_NOSIGNAL
+            const auto n = ::send(fd, message.data() + written, message.size() - written, MSG_NOSIGNAL);
+#else
+            const auto n = ::send(fd, message.data() + written, message.size() - written, 0);
+#endif
+            // the client has gone away
+            if (n <= 0) {
+                return;
+            }
+            written += static_cast<std::size_t>(n);
+        }
+    }
+
+    void Server::listen() {
+        sockaddr_un address{};
+        if (options.socketPath.empty() || options.socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Invalid socket path " + options.socketPath + ".");
+        }
+        address.sun_family = AF_UNIX;
+        options.socketPath.copy(address.sun_path, options.socketPath.size());
+
+        listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0) {
+            throw std::runtime_error("Could not create socket.");
+        }
+
+        // remove a stale socket from a previous run
+        ::unlink(options.socketPath.c_str());
+        if (::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(listenFd, SOMAXCONN) < 0) {
+            ::close(listenFd);
+            listenFd = -1;
+            throw std::runtime_error("Could not listen on socket " + options.socketPath + ".");
+        }
+    }
+
+    void Server::run() {
+        listen();
+
+        for (std::size_t i = 0U; i < options.nthreads; ++i) {
+            workers.emplace_back([this] { work(); });
+        }
+
+        while (!stopped) {
+            // periodically wake up in order to check whether the server shall be stopped
+            pollfd     pfd{listenFd, POLLIN, 0};
+            const auto ready = ::poll(&pfd, 1, 200);
+            if (ready <= 0) {
+                continue;
+            }
+
+            const auto fd = ::accept(listenFd, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+
+            auto client = std::make_shared<Client>(fd);
+            {
+                std::lock_guard clientsLock(clientsMutex);
+                clients.erase(std::remove_if(clients.begin(), clients.end(), [](const auto& c) { return c.expired(); }), clients.end());
+                clients.emplace_back(client);
+            }
+            ++activeReaders;
+            std::thread([this, client] { serve(client); }).detach();
+        }
+
+        // stop accepting new connections
+        ::close(listenFd);
+        listenFd = -1;
+        ::unlink(options.socketPath.c_str());
+
+        // unblock all clients that are waiting for further requests
+        {
+            std::lock_guard clientsLock(clientsMutex);
+            for (const auto& c: clients) {
+                if (const auto client = c.lock()) {
+                    ::shutdown(client->fd, SHUT_RD);
+                }
+            }
+        }
+        while (activeReaders > 0U) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        // finish all pending requests
+        for (std::size_t i = 0U; i < workers.size(); ++i) {
+            requests.push(std::nullopt);
+        }
+        for (auto& worker: workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    void Server::serve(const std::shared_ptr<Client>& client) {
+        std::string buffer{};
+        char        chunk[4096];
+        // whether the remainder of an overlong line is skipped
+        bool skipping = false;
+        while (!stopped) {
+            const auto n = ::recv(client->fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<std::size_t>(n));
+
+            std::size_t pos = 0U;
+            while ((pos = buffer.find('\n')) != std::string::npos) {
+                if (skipping) {
+                    skipping = false;
+                } else if (pos > options.maxRequestSize) {
+                    client->send({{"error", "Request exceeds the maximum size of " + std::to_string(options.maxRequestSize) + " bytes."}});
+                } else if (pos > 0U) {
+                    handle(client, buffer.substr(0U, pos));
+                }
+                buffer.erase(0U, pos + 1U);
+            }
+
+            // the buffer only grows up to the maximum size. The rest of the line is skipped
+            if (buffer.size() > options.maxRequestSize) {
+                if (!skipping) {
+                    client->send({{"error", "Request exceeds the maximum size of " + std::to_string(options.maxRequestSize) + " bytes."}});
+                    skipping = true;
+                }
+                buffer.clear();
+            }
+        }
+        --activeReaders;
+    }
+#endif
+
+    void Server::handle(const std::shared_ptr<Client>& client, const std::string& line) {
+        Request request{client};
+        try {
+            request.request = nlohmann::json::parse(line);
+        } catch (const nlohmann::json::exception& e) {
+            client->send({{"error", std::string("Malformed request: ") + e.what()}});
+            return;
+        }
+        if (request.request.contains("id")) {
+            request.id = request.request.at("id");
+        }
+        if (!request.request.contains("pair") && (!request.request.contains("circuit1") || !request.request.contains("circuit2"))) {
+            client->send({{"id", request.id}, {"error", "Request has to contain both circuits or a preprocessed pair."}});
+            return;
+        }
+
+        // identical requests (circuits, formats, configuration, and timeout) are answered from the cache
+        auto key = request.request;
+        key.erase("id");
+        request.cacheKey = key.dump();
+        if (auto cached = lookup(request.cacheKey)) {
+            (*cached)["id"]     = request.id;
+            (*cached)["cached"] = true;
+            client->send(*cached);
+            return;
+        }
+
+        // admission control
+        if (pending.fetch_add(1U) >= options.maxPending) {
+            --pending;
+            client->send({{"id", request.id}, {"error", "Server busy. Too many pending requests."}});
+            return;
+        }
+        requests.push(std::move(request));
+    }
+
+    void Server::work() {
+        while (true) {
+            const auto request = requests.waitAndPop();
+            if (!request->has_value()) {
+                return;
+            }
+            process(**request);
+            --pending;
+        }
+    }
+
+    void Server::process(Request& request) {
+        nlohmann::json response{};
+        try {
+            const auto& req = request.request;
+
+            auto configuration = defaults;
+            if (req.contains("configuration")) {
+                configuration = Configuration::fromJson(req.at("configuration"), configuration);
+            }
+            if (req.contains("timeout")) {
+                configuration.execution.timeout = std::chrono::round<std::chrono::milliseconds>(std::chrono::duration<double>(req.at("timeout").get<double>()));
+            }
+
+            std::unique_ptr<EquivalenceCheckingManager> ecm{};
+            if (req.contains("pair")) {
+                const auto data = base64Decode(req.at("pair").get<std::string>());
+                ecm             = std::make_unique<EquivalenceCheckingManager>(PreprocessedPair::read(data.data(), data.size()), configuration);
+            } else {
+                const auto format = req.contains("format") ? req.at("format").get<std::string>() : std::string("qasm");
+                const auto qc1    = parseCircuit(req.at("circuit1").get<std::string>(), req.contains("format1") ? req.at("format1").get<std::string>() : format);
+                const auto qc2    = parseCircuit(req.at("circuit2").get<std::string>(), req.contains("format2") ? req.at("format2").get<std::string>() : format);
+                ecm               = std::make_unique<EquivalenceCheckingManager>(qc1, qc2, configuration);
+            }
+            ecm->run();
+            response = ecm->json();
+
+            // results that are inconclusive (e.g., due to a timeout) might differ for a subsequent request
+            if (ecm->equivalence() != EquivalenceCriterion::NoInformation) {
+                store(request.cacheKey, response);
+            }
+        } catch (const std::exception& e) {
+            response["error"] = e.what();
+        }
+        response["id"]     = request.id;
+        response["cached"] = false;
+        request.client->send(response);
+    }
+
+    std::optional<nlohmann::json> Server::lookup(const std::string& key) {
+        std::lock_guard cacheLock(cacheMutex);
+        const auto      it = cacheIndex.find(key);
+        if (it == cacheIndex.end()) {
+            return std::nullopt;
+        }
+        // mark the entry as most recently used
+        cache.splice(cache.begin(), cache, it->second);
+        return it->second->second;
+    }
+
+    void Server::store(const std::string& key, const nlohmann::json& result) {
+        if (options.cacheSize == 0U) {
+            return;
+        }
+        std::lock_guard cacheLock(cacheMutex);
+        if (const auto it = cacheIndex.find(key); it != cacheIndex.end()) {
+            it->second->second = result;
+            cache.splice(cache.begin(), cache, it->second);
+            return;
+        }
+        cache.emplace_front(key, result);
+        cacheIndex.emplace(key, cache.begin());
+        if (cache.size() > options.cacheSize) {
+            cacheIndex.erase(cache.back().first);
+            cache.pop_back();
+        }
+    }
+} // namespace ec
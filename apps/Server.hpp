@@ -0,0 +1,112 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "ThreadSafeQueue.hpp"
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ec {
+    // base64 encoding (with padding) as used for the binary payloads of the server
+    std::string base64Encode(const std::string& data);
+    std::string base64Decode(const std::string& encoded);
+
+    // Long-running verification server listening on a local Unix socket.
+    //
+    // Clients send one JSON request per line:
+    //   {"id": <any>, "circuit1": "<source>", "circuit2": "<source>", "format": "qasm", "configuration": {...}, "timeout": <seconds>}
+    // where only the circuits are mandatory and the timeout may be fractional. The configuration uses the keys of `Configuration::json()` and is applied
+    // on top of the server's defaults. The format applies to both circuits and may also be given per circuit ("format1", "format2").
+    // Instead of the circuits, a request may contain an already preprocessed pair of circuits ("pair") in the binary format of
+    // `PreprocessedPair`, encoded in base64. Lines longer than `maxRequestSize` are rejected without being parsed.
+    //
+    // Requests are processed asynchronously by a pool of worker threads that is kept alive for the lifetime of the server.
+    // For each request, exactly one JSON line is sent back to the client (in order of completion). It contains the
+    // result of `EquivalenceCheckingManager::json()` together with the request's id and whether it was served from the
+    // result cache, or an "error" entry if the request could not be processed (including requests that are rejected
+    // because too many requests are pending).
+    class Server {
+    public:
+        struct Options {
+            std::string socketPath{};
+            std::size_t nthreads   = Resources::get().threads();
+            std::size_t maxPending = 256U;  // requests that are queued or running at the same time
+            std::size_t cacheSize  = 1024U; // number of results that are kept in memory
+            std::size_t maxRequestSize = 64U * 1024U * 1024U; // maximum length of a request line (in bytes)
+        };
+
+        Server(Options options, Configuration defaults);
+        ~Server();
+
+        Server(const Server&)            = delete;
+        Server& operator=(const Server&) = delete;
+
+        // listen for and serve requests until `stop()` is called
+        void run();
+
+        // request the server to shut down. this is safe to be called from a signal handler
+        void stop() noexcept { stopped = true; }
+
+    protected:
+        struct Client {
+            int        fd;
+            std::mutex writeMutex{};
+
+            explicit Client(int fd):
+                fd(fd) {}
+            ~Client();
+
+            void send(const nlohmann::json& response);
+        };
+
+        struct Request {
+            std::shared_ptr<Client> client{};
+            nlohmann::json          id{};
+            nlohmann::json          request{};
+            std::string             cacheKey{};
+        };
+
+        Options       options;
+        Configuration defaults;
+
+        std::atomic<bool> stopped{false};
+        int               listenFd = -1;
+
+        ThreadSafeQueue<std::optional<Request>> requests{};
+        std::atomic<std::size_t>                pending{0U};
+        std::vector<std::thread>                workers{};
+
+        std::mutex                         clientsMutex{};
+        std::vector<std::weak_ptr<Client>> clients{};
+        std::atomic<std::size_t>           activeReaders{0U};
+
+        // least-recently-used cache of results
+        using CacheEntry = std::pair<std::string, nlohmann::json>;
+        std::mutex                                                         cacheMutex{};
+        std::list<CacheEntry>                                              cache{};
+        std::unordered_map<std::string, std::list<CacheEntry>::iterator> cacheIndex{};
+
+        std::optional<nlohmann::json> lookup(const std::string& key);
+        void                          store(const std::string& key, const nlohmann::json& result);
+
+        void listen();
+        void serve(const std::shared_ptr<Client>& client);
+        void handle(const std::shared_ptr<Client>& client, const std::string& line);
+        void work();
+        void process(Request& request);
+    };
+} // namespace ec
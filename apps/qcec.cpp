@@ -0,0 +1,291 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Driver.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "Server.hpp"
+#include "ThreadSafeQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    void showUsage(const std::string& name) {
+        std::cerr << "Usage: " << name << " [options] <circuit1> <circuit2> [<circuit1> <circuit2> ...]\n"
+                  << "       " << name << " [options] --manifest <file>\n"
+                  << "       " << name << " [options] --serve <socket>\n"
+                  << "\n"
+                  << "Checks the equivalence of pairs of circuits and writes one JSON object per pair (one per line).\n"
+                  << "A manifest lists one pair of circuit files per line (separated by whitespace). Empty lines and lines starting with '#' are ignored.\n"
+                  << "\n"
+                  << "Options:\n"
+                  << "  --manifest <file>           read the pairs to check from <file>\n"
+                  << "  --output <file>             write the results to <file> instead of stdout\n"
+                  << "  --serve <socket>            run as a server that accepts requests on the Unix socket <socket>\n"
+                  << "  --max-pending <n>           (server) maximum number of queued or running requests (default: 256)\n"
+                  << "  --cache-size <n>            (server) maximum number of cached results (default: 1024)\n"
+                  << "  --max-request-size <n>      (server) maximum length of a request in bytes (default: 67108864)\n"
+                  << "  --threads <n>               number of pairs that are checked concurrently (default: hardware concurrency)\n"
+                  << "  --timeout <seconds>         timeout per pair or request, e.g., 0.25 (default: no timeout)\n"
+                  << "  --parallel                  additionally parallelize the check of each individual pair\n"
+                  << "  --no-simulation             do not run the simulation checker\n"
+                  << "  --no-alternating            do not run the alternating checker\n"
+                  << "  --construction              run the construction checker\n"
+                  << "  --max-sims <n>              maximum number of simulations per pair\n"
+                  << "  --seed <n>                  seed for the stimuli generation\n"
+                  << "  --fix-output-permutation    try to fix mismatches in the output permutations\n"
+                  << "  --transform-dynamic         transform dynamic circuits to unitary circuits\n"
+                  << "  --dynamic-circuit-checker   check dynamic circuits natively\n"
+                  << "  -h, --help                  show this help message\n";
+    }
+
+    // a pair whose circuits have already been loaded (or that failed to load)
+    struct Job {
+        ec::CircuitPair                       pair{};
+        std::optional<qc::QuantumComputation> qc1{};
+        std::optional<qc::QuantumComputation> qc2{};
+        std::string                           error{};
+        double                                loadTime{};
+    };
+
+    ec::Server* server = nullptr;
+
+    extern "C" void handleSignal(int /*signal*/) {
+        if (server != nullptr) {
+            server->stop();
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::string name = argc > 0 ? argv[0] : "qcec";
+
+    ec::Configuration config{};
+    // parallelism is exploited across pairs by default
+    config.execution.parallel = false;
+
+    std::size_t              nthreads = ec::Resources::get().threads();
+    std::vector<std::string> files{};
+    std::string              manifest{};
+    std::string              output{};
+    ec::Server::Options      serverOptions{};
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+
+            const auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("Missing value for option " + arg);
+                }
+                return argv[++i];
+            };
+
+            if (arg == "-h" || arg == "--help") {
+                showUsage(name);
+                return 0;
+            } else if (arg == "--manifest") {
+                manifest = value();
+            } else if (arg == "--output") {
+                output = value();
+            } else if (arg == "--serve") {
+                serverOptions.socketPath = value();
+            } else if (arg == "--max-pending") {
+                serverOptions.maxPending = std::stoul(value());
+            } else if (arg == "--cache-size") {
+                serverOptions.cacheSize = std::stoul(value());
+            } else if (arg == "--max-request-size") {
+                serverOptions.maxRequestSize = std::stoul(value());
+            } else if (arg == "--threads") {
+                nthreads = std::max<std::size_t>(1U, std::stoul(value()));
+            } else if (arg == "--timeout") {
+                config.execution.timeout = std::chrono::round<std::chrono::milliseconds>(std::chrono::duration<double>(std::stod(value())));
+            } else if (arg == "--parallel") {
+                config.execution.parallel = true;
+            } else if (arg == "--no-simulation") {
+                config.execution.runSimulationChecker = false;
+            } else if (arg == "--no-alternating") {
+                config.execution.runAlternatingChecker = false;
+            } else if (arg == "--construction") {
+                config.execution.runConstructionChecker = true;
+            } else if (arg == "--max-sims") {
+                config.simulation.maxSims = std::stoul(value());
+            } else if (arg == "--seed") {
+                config.simulation.seed = std::stoul(value());
+            } else if (arg == "--fix-output-permutation") {
+                config.optimizations.fixOutputPermutationMismatch = true;
+            } else if (arg == "--transform-dynamic") {
+                config.optimizations.transformDynamicCircuit = true;
+            } else if (arg == "--dynamic-circuit-checker") {
+                config.execution.runDynamicCircuitChecker = true;
+            } else if (arg.rfind("--", 0) == 0) {
+                throw std::invalid_argument("Unknown option " + arg);
+            } else {
+                files.emplace_back(arg);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n\n";
+        showUsage(name);
+        return 2;
+    }
+
+    if (!serverOptions.socketPath.empty()) {
+        serverOptions.nthreads = nthreads;
+        ec::Server instance(serverOptions, config);
+        server = &instance;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+#ifdef SIGPIPE
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+        try {
+            instance.run();
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            server = nullptr;
+            return 2;
+        }
+        server = nullptr;
+        return 0;
+    }
+
+    std::vector<ec::CircuitPair> pairs{};
+    try {
+        if (!manifest.empty()) {
+            pairs = ec::readManifest(manifest);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+    if (files.size() % 2U != 0U) {
+        std::cerr << "Circuits have to be specified in pairs.\n\n";
+        showUsage(name);
+        return 2;
+    }
+    for (std::size_t i = 0U; i < files.size(); i += 2U) {
+        pairs.push_back({pairs.size(), files[i], files[i + 1U]});
+    }
+    if (pairs.empty()) {
+        showUsage(name);
+        return 2;
+    }
+
+    std::ofstream outputFile{};
+    if (!output.empty()) {
+        outputFile.open(output);
+        if (!outputFile.good()) {
+            std::cerr << "Could not open output file " << output << std::endl;
+            return 2;
+        }
+    }
+    std::ostream& out = output.empty() ? std::cout : outputFile;
+    std::mutex    outMutex{};
+
+    nthreads = std::min(nthreads, pairs.size());
+
+    // circuits are loaded by a separate thread so that loading overlaps with checking.
+    // at most a couple of loaded pairs per worker are kept in memory at any time
+    ThreadSafeQueue<std::optional<Job>> jobs{};
+    std::mutex                          loadedMutex{};
+    std::condition_variable             loadedCond{};
+    std::size_t                         loaded    = 0U;
+    const std::size_t                   maxLoaded = 2U * nthreads;
+
+    std::thread loader([&] {
+        for (const auto& pair: pairs) {
+            {
+                std::unique_lock loadedLock(loadedMutex);
+                loadedCond.wait(loadedLock, [&] { return loaded < maxLoaded; });
+                ++loaded;
+            }
+
+            Job        job{pair};
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                job.qc1.emplace(pair.file1);
+                job.qc2.emplace(pair.file2);
+            } catch (const std::exception& e) {
+                job.error = std::string("Failed to load circuits: ") + e.what();
+            }
+            const auto end = std::chrono::steady_clock::now();
+            job.loadTime   = std::chrono::duration<double>(end - start).count();
+            jobs.push(std::move(job));
+        }
+        // signal all workers that there is nothing left to do
+        for (std::size_t i = 0U; i < nthreads; ++i) {
+            jobs.push(std::nullopt);
+        }
+    });
+
+    std::atomic<std::size_t> nonEquivalent{0U};
+    std::atomic<std::size_t> errors{0U};
+
+    std::vector<std::thread> workers{};
+    workers.reserve(nthreads);
+    for (std::size_t t = 0U; t < nthreads; ++t) {
+        workers.emplace_back([&] {
+            while (true) {
+                const auto job = jobs.waitAndPop();
+                if (!job->has_value()) {
+                    return;
+                }
+                auto& [pair, qc1, qc2, error, loadTime] = **job;
+
+                nlohmann::json result{};
+                if (error.empty()) {
+                    try {
+                        ec::EquivalenceCheckingManager ecm(*qc1, *qc2, config);
+                        // the circuits are no longer needed once they have been copied into the manager
+                        qc1.reset();
+                        qc2.reset();
+                        ecm.run();
+                        result = ecm.json();
+                        if (!ecm.getResults().consideredEquivalent()) {
+                            ++nonEquivalent;
+                        }
+                    } catch (const std::exception& e) {
+                        error = e.what();
+                    }
+                }
+                if (!error.empty()) {
+                    ++errors;
+                }
+                result = ec::formatResult(pair, loadTime, result, error);
+
+                {
+                    std::lock_guard loadedLock(loadedMutex);
+                    --loaded;
+                }
+                loadedCond.notify_one();
+
+                const auto line = result.dump();
+                std::lock_guard outLock(outMutex);
+                out << line << std::endl;
+            }
+        });
+    }
+
+    loader.join();
+    for (auto& worker: workers) {
+        worker.join();
+    }
+
+    if (errors > 0U) {
+        return 2;
+    }
+    return nonEquivalent > 0U ? 1 : 0;
+}
@@ -8,12 +8,14 @@
 #include "checker/dd/applicationscheme/ApplicationScheme.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
 #include "checker/dd/simulation/StateGenerator.hpp"
+#include "Resources.hpp"
 #include "dd/Package.hpp"
 #include "nlohmann/json.hpp"
 
 #include <chrono>
 #include <functional>
 #include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -23,13 +25,44 @@ namespace ec {
         struct Execution {
             dd::fp numericalTolerance = dd::ComplexTable<>::tolerance();
 
-            bool                 parallel = true;
-            std::size_t          nthreads = std::max(2U, std::thread::hardware_concurrency());
-            std::chrono::seconds timeout  = 0s;
+            bool        parallel = true;
+            std::size_t nthreads = std::max<std::size_t>(2U, Resources::get().threads());
+            // overall time limit for `run` (0ms means no timeout)
+            std::chrono::milliseconds timeout = 0ms;
+
+            // interleave the simulation, alternating, and construction checker of a sequential check in time slices of the
+            // given length, so that a check that is hard for one checker but easy for another does not exhaust the entire budget.
+            // Defaults to 0ms, i.e., the checkers run one after another
+            std::chrono::milliseconds timeSlice = 0ms;
+
+            // time budgets of the individual checkers within the overall timeout (0ms means no separate budget).
+            // Once the budget of a checker runs out, it is stopped and the remaining checkers proceed. For simulations,
+            // the budget covers all simulations. Budgets are measured from the start of the respective checker (or, for
+            // parallel checks, from the start of the check). When interleaving checkers, only their own time slices count.
+            std::chrono::milliseconds simulationBudget   = 0ms;
+            std::chrono::milliseconds alternatingBudget  = 0ms;
+            std::chrono::milliseconds constructionBudget = 0ms;
 
             bool runConstructionChecker = false;
             bool runSimulationChecker   = true;
             bool runAlternatingChecker  = true;
+
+            // natively check circuits containing dynamic circuit primitives (mid-circuit measurements, resets, and
+            // classically-controlled operations) instead of transforming them to unitary circuits.
+            // Takes precedence over `transformDynamicCircuit` and replaces all other checkers for dynamic circuits.
+            bool runDynamicCircuitChecker = false;
+
+            // check circuits that only consist of (multi-)controlled X and SWAP gates by comparing their truth tables.
+            // Only applies if both circuits are classical reversible and precedes all other checkers.
+            bool runReversibleChecker = true;
+
+            // check circuits that only consist of X, CNOT, SWAP, and (singly-controlled) phase gates by comparing their
+            // affine parts and phase polynomials. Only applies if both circuits are of this form.
+            bool runPhasePolynomialChecker = true;
+
+            // keep all checkers (including their decision diagram packages) alive after they have finished, e.g., for debugging.
+            // Otherwise, only their statistics are kept and the memory is freed as soon as a checker is no longer needed
+            bool retainCheckers = false;
         };
 
         // configuration options for pre-check optimizations
@@ -60,11 +93,43 @@ namespace ec {
         // configuration options for the simulation scheme
         struct Simulation {
             double      fidelityThreshold = 1e-8;
-            std::size_t maxSims           = std::max(16U, std::thread::hardware_concurrency() - 2U);
+            std::size_t maxSims           = std::max<std::size_t>(16U, Resources::get().threads(2U));
             StateType   stateType         = StateType::ComputationalBasis;
             std::size_t seed              = 0U;
             bool        storeCEXinput     = false;
             bool        storeCEXoutput    = false;
+            // simulate both circuits on separate threads (each with its own decision diagram package) for every stimulus.
+            // This reduces the latency of each simulation at the cost of one additional thread per simulation. In parallel
+            // checks, only half as many simulations run at the same time, so that `nthreads` is respected
+            bool concurrent = false;
+            // simulate the first circuit followed by the inverse of the second circuit and compare the result to the initial
+            // state. Only a single state is kept per simulation. Circuits with garbage qubits are always simulated separately
+            bool inverse = false;
+            // share the results of gate applications between all simulations of a manager (across their decision diagram
+            // packages) via a lock-free, lossy table. This mostly pays off for parallel simulations of circuits whose states
+            // remain small for a while. The hit rate is reported in the results
+            bool sharedComputeTable = false;
+        };
+
+        // configuration options for the reversible checker
+        struct Reversible {
+            // circuits with at most this many (non-ancillary) inputs are checked for all input assignments
+            std::size_t maxExhaustiveInputs = 20U;
+            // number of random input assignments that are checked for larger circuits
+            std::size_t nRandomStimuli = 1U << 16U;
+        };
+
+        // configuration options for circuits with symbolic parameters
+        struct Parameterized {
+            // number of random parameter instantiations that are checked whenever equivalence cannot be shown symbolically
+            std::size_t nInstantiations = 8U;
+        };
+
+        // configuration options for partial equivalence checking
+        struct PartialEquivalence {
+            // logical output qubits whose state is relevant for the equivalence. All remaining outputs are treated as garbage.
+            // If empty, all outputs (besides those already marked as garbage in the circuits) are relevant
+            std::vector<dd::Qubit> relevantOutputs{};
         };
 
         Execution     execution{};
@@ -72,6 +137,10 @@ namespace ec {
         Application   application{};
         Functionality functionality{};
         Simulation    simulation{};
+        Reversible    reversible{};
+        Parameterized parameterized{};
+
+        PartialEquivalence partialEquivalence{};
 
         [[nodiscard]] bool anythingToExecute() const noexcept {
             return (execution.runSimulationChecker && simulation.maxSims > 0U) || execution.runAlternatingChecker || execution.runConstructionChecker;
@@ -100,8 +169,30 @@ namespace ec {
             exe["run_construction_checker"] = execution.runConstructionChecker;
             exe["run_simulation_checker"]   = execution.runSimulationChecker;
             exe["run_alternating_checker"]  = execution.runAlternatingChecker;
-            if (execution.timeout > 0s) {
-                exe["timeout"] = execution.timeout.count();
+            if (execution.runDynamicCircuitChecker) {
+                exe["run_dynamic_circuit_checker"] = true;
+            }
+            exe["run_reversible_checker"]       = execution.runReversibleChecker;
+            exe["run_phase_polynomial_checker"] = execution.runPhasePolynomialChecker;
+            if (execution.retainCheckers) {
+                exe["retain_checkers"] = true;
+            }
+            // all durations are given in seconds
+            const auto seconds = [](std::chrono::milliseconds duration) { return std::chrono::duration<double>(duration).count(); };
+            if (execution.timeout > 0ms) {
+                exe["timeout"] = seconds(execution.timeout);
+            }
+            if (execution.timeSlice > 0ms) {
+                exe["time_slice"] = seconds(execution.timeSlice);
+            }
+            if (execution.simulationBudget > 0ms) {
+                exe["simulation_budget"] = seconds(execution.simulationBudget);
+            }
+            if (execution.alternatingBudget > 0ms) {
+                exe["alternating_budget"] = seconds(execution.alternatingBudget);
+            }
+            if (execution.constructionBudget > 0ms) {
+                exe["construction_budget"] = seconds(execution.constructionBudget);
             }
             auto& opt                                   = config["optimizations"];
             opt["fix_output_permutation_mismatch"]      = optimizations.fixOutputPermutationMismatch;
@@ -144,13 +235,138 @@ namespace ec {
                 sim["seed"]                        = simulation.seed;
                 sim["store_counterexample_input"]  = simulation.storeCEXinput;
                 sim["store_counterexample_output"] = simulation.storeCEXoutput;
+                sim["concurrent"]                  = simulation.concurrent;
+                sim["inverse"]                     = simulation.inverse;
+                sim["shared_compute_table"]        = simulation.sharedComputeTable;
+            }
+
+            if (execution.runReversibleChecker) {
+                auto& rev                    = config["reversible"];
+                rev["max_exhaustive_inputs"] = reversible.maxExhaustiveInputs;
+                rev["n_random_stimuli"]      = reversible.nRandomStimuli;
             }
 
+            if (!partialEquivalence.relevantOutputs.empty()) {
+                auto& partial = config["partial_equivalence"]["relevant_outputs"];
+                partial       = nlohmann::json::array();
+                for (const auto& q: partialEquivalence.relevantOutputs) {
+                    partial.push_back(static_cast<std::size_t>(q));
+                }
+            }
+
+            auto& par               = config["parameterized"];
+            par["n_instantiations"] = parameterized.nInstantiations;
+
             return config;
         }
 
         [[nodiscard]] std::string toString() const noexcept {
             return json().dump(2);
         }
+
+        // create a configuration from its JSON representation (as produced by `json()`).
+        // any option that is not specified keeps its value from the given base configuration
+        [[nodiscard]] static Configuration fromJson(const nlohmann::json& config) {
+            return fromJson(config, Configuration{});
+        }
+        [[nodiscard]] static Configuration fromJson(const nlohmann::json& config, Configuration configuration) {
+
+            const auto read = [](const nlohmann::json& j, const char* key, auto& value) {
+                if (j.contains(key)) {
+                    j.at(key).get_to(value);
+                }
+            };
+            // durations are given in seconds (possibly fractional) and rounded to milliseconds
+            const auto readDuration = [](const nlohmann::json& j, const char* key, std::chrono::milliseconds& value) {
+                if (j.contains(key)) {
+                    value = std::chrono::round<std::chrono::milliseconds>(std::chrono::duration<double>(j.at(key).get<double>()));
+                }
+            };
+
+            if (config.contains("execution")) {
+                const auto& exe = config.at("execution");
+                read(exe, "tolerance", configuration.execution.numericalTolerance);
+                read(exe, "parallel", configuration.execution.parallel);
+                read(exe, "nthreads", configuration.execution.nthreads);
+                read(exe, "run_construction_checker", configuration.execution.runConstructionChecker);
+                read(exe, "run_simulation_checker", configuration.execution.runSimulationChecker);
+                read(exe, "run_alternating_checker", configuration.execution.runAlternatingChecker);
+                read(exe, "run_dynamic_circuit_checker", configuration.execution.runDynamicCircuitChecker);
+                read(exe, "run_reversible_checker", configuration.execution.runReversibleChecker);
+                read(exe, "run_phase_polynomial_checker", configuration.execution.runPhasePolynomialChecker);
+                read(exe, "retain_checkers", configuration.execution.retainCheckers);
+                readDuration(exe, "timeout", configuration.execution.timeout);
+                readDuration(exe, "time_slice", configuration.execution.timeSlice);
+                readDuration(exe, "simulation_budget", configuration.execution.simulationBudget);
+                readDuration(exe, "alternating_budget", configuration.execution.alternatingBudget);
+                readDuration(exe, "construction_budget", configuration.execution.constructionBudget);
+            }
+
+            if (config.contains("optimizations")) {
+                const auto& opt = config.at("optimizations");
+                read(opt, "fix_output_permutation_mismatch", configuration.optimizations.fixOutputPermutationMismatch);
+                read(opt, "fuse_consecutive_single_qubit_gates", configuration.optimizations.fuseSingleQubitGates);
+                read(opt, "reconstruct_swaps", configuration.optimizations.reconstructSWAPs);
+                read(opt, "remove_diagonal_gates_before_measure", configuration.optimizations.removeDiagonalGatesBeforeMeasure);
+                read(opt, "transform_dynamic_circuit", configuration.optimizations.transformDynamicCircuit);
+                read(opt, "reorder_operations", configuration.optimizations.reorderOperations);
+            }
+
+            if (config.contains("application")) {
+                const auto& app = config.at("application");
+                if (app.contains("construction")) {
+                    configuration.application.constructionScheme = applicationSchemeFromString(app.at("construction").get<std::string>());
+                }
+                if (app.contains("simulation")) {
+                    configuration.application.simulationScheme = applicationSchemeFromString(app.at("simulation").get<std::string>());
+                }
+                if (app.contains("alternating")) {
+                    configuration.application.alternatingScheme = applicationSchemeFromString(app.at("alternating").get<std::string>());
+                }
+                // the default cost function is indicated by a placeholder
+                if (app.contains("profile") && app.at("profile").get<std::string>() != "cost_function") {
+                    configuration.application.profile = app.at("profile").get<std::string>();
+                }
+            }
+
+            if (config.contains("functionality")) {
+                read(config.at("functionality"), "trace_threshold", configuration.functionality.traceThreshold);
+            }
+
+            if (config.contains("simulation")) {
+                const auto& sim = config.at("simulation");
+                read(sim, "fidelity_threshold", configuration.simulation.fidelityThreshold);
+                read(sim, "max_sims", configuration.simulation.maxSims);
+                if (sim.contains("state_type")) {
+                    configuration.simulation.stateType = stateTypeFromString(sim.at("state_type").get<std::string>());
+                }
+                read(sim, "seed", configuration.simulation.seed);
+                read(sim, "store_counterexample_input", configuration.simulation.storeCEXinput);
+                read(sim, "store_counterexample_output", configuration.simulation.storeCEXoutput);
+                read(sim, "concurrent", configuration.simulation.concurrent);
+                read(sim, "inverse", configuration.simulation.inverse);
+                read(sim, "shared_compute_table", configuration.simulation.sharedComputeTable);
+            }
+
+            if (config.contains("reversible")) {
+                const auto& rev = config.at("reversible");
+                read(rev, "max_exhaustive_inputs", configuration.reversible.maxExhaustiveInputs);
+                read(rev, "n_random_stimuli", configuration.reversible.nRandomStimuli);
+            }
+
+            if (config.contains("partial_equivalence") && config.at("partial_equivalence").contains("relevant_outputs")) {
+                // the given outputs replace (rather than extend) those of the defaults
+                configuration.partialEquivalence.relevantOutputs.clear();
+                for (const auto& q: config.at("partial_equivalence").at("relevant_outputs")) {
+                    configuration.partialEquivalence.relevantOutputs.emplace_back(static_cast<dd::Qubit>(q.get<std::size_t>()));
+                }
+            }
+
+            if (config.contains("parameterized")) {
+                read(config.at("parameterized"), "n_instantiations", configuration.parameterized.nInstantiations);
+            }
+
+            return configuration;
+        }
     };
 } // namespace ec
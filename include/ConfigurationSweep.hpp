@@ -0,0 +1,57 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "EquivalenceCriterion.hpp"
+#include "QuantumComputation.hpp"
+#include "nlohmann/json.hpp"
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ec {
+    // Checks a single pair of circuits under many different configurations, e.g., in order to tune the configuration for a class of circuits.
+    // The circuits are only preprocessed once for every distinct preprocessing setting (optimizations and partial equivalence)
+    // and the resulting managers are run one after another, so that their runtimes can be compared. The parallelism of each
+    // individual check is determined by its configuration.
+    class ConfigurationSweep {
+    public:
+        struct Entry {
+            Configuration        configuration{};
+            EquivalenceCriterion equivalence = EquivalenceCriterion::NoInformation;
+            // time spent preprocessing the circuits (shared by all configurations with the same preprocessing setting)
+            double      preprocessingTime{};
+            double      checkTime{};
+            std::size_t maxNodes{};
+            std::string error{};
+
+            [[nodiscard]] bool           conclusive() const { return error.empty() && equivalence != EquivalenceCriterion::NoInformation; }
+            [[nodiscard]] nlohmann::json json() const;
+        };
+
+        ConfigurationSweep(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, std::vector<Configuration> configurations);
+
+        void run();
+
+        [[nodiscard]] const std::vector<Entry>& getEntries() const { return entries; }
+        // the configuration that conclusively checked the pair the fastest (ties are broken by the number of nodes)
+        [[nodiscard]] std::optional<std::size_t> best() const;
+
+        [[nodiscard]] nlohmann::json json() const;
+        // comparative table of all configurations. Only the options that differ from the first configuration are listed
+        [[nodiscard]] std::string toString() const;
+        friend std::ostream&      operator<<(std::ostream& os, const ConfigurationSweep& sweep) { return os << sweep.toString(); }
+
+    protected:
+        qc::QuantumComputation qc1{};
+        qc::QuantumComputation qc2{};
+
+        std::vector<Entry> entries{};
+    };
+} // namespace ec
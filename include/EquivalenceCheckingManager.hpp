@@ -8,17 +8,28 @@
 #include "CircuitOptimizer.hpp"
 #include "Configuration.hpp"
 #include "EquivalenceCriterion.hpp"
+#include "OriginalCache.hpp"
+#include "PreprocessedPair.hpp"
 #include "QuantumComputation.hpp"
 #include "ThreadSafeQueue.hpp"
+#include "ToleranceScope.hpp"
 #include "checker/dd/DDAlternatingChecker.hpp"
 #include "checker/dd/DDConstructionChecker.hpp"
+#include "checker/dd/DDDynamicCircuitChecker.hpp"
 #include "checker/dd/DDSimulationChecker.hpp"
 #include "checker/dd/simulation/StateGenerator.hpp"
+#include "checker/phasepolynomial/PhasePolynomialChecker.hpp"
+#include "checker/reversible/ReversibleChecker.hpp"
+#include "parameterized/SymbolicOperation.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -38,6 +49,11 @@ namespace ec {
             dd::CVec    cexOutput1{};
             dd::CVec    cexOutput2{};
 
+            std::size_t performedInstantiations = 0U;
+
+            // the time budgets that ran out during the check ("simulation", "alternating", "construction", or "total" for the timeout)
+            std::vector<std::string> exhaustedBudgets{};
+
             [[nodiscard]] bool consideredEquivalent() const {
                 switch (equivalence) {
                     case EquivalenceCriterion::Equivalent:
@@ -66,6 +82,9 @@ namespace ec {
         };
 
         EquivalenceCheckingManager(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration = Configuration{});
+        // construct a manager from an already preprocessed pair of circuits. The optimization and partial equivalence options
+        // of the configuration are replaced by the ones that have been used for preprocessing the pair
+        explicit EquivalenceCheckingManager(PreprocessedPair pair, const Configuration& configuration = Configuration{});
 
         void run();
 
@@ -73,6 +92,8 @@ namespace ec {
             stateGenerator.clear();
             results = Results{};
             checkers.clear();
+            checkerResults.clear();
+            instantiatedCircuits.clear();
         }
 
         [[nodiscard]] nlohmann::json json() const;
@@ -85,18 +106,28 @@ namespace ec {
         [[nodiscard]] Configuration getConfiguration() const { return configuration; }
         [[nodiscard]] Results       getResults() const { return results; }
 
+        // the preprocessed circuits (e.g., for checking them with other configurations or storing them via `PreprocessedPair::write`)
+        [[nodiscard]] PreprocessedPair getPreprocessedPair() const;
+
+        // Share the final representations of an original circuit with all other managers using the same cache, e.g., when
+        // checking many compiled circuits against the same original circuit. The original circuit is the first circuit
+        // passed to the constructor (or the first circuit of a preprocessed pair). Simulations only use the cache for a fixed seed.
+        void setOriginalCache(std::shared_ptr<OriginalCache> cache) { originalCache = std::move(cache); }
+
         // convenience functions for changing the configuration after the manager has been constructed:
         // Execution: These settings may be changed to influence what is executed during `run`
-        void setTolerance(dd::fp tol) {
-            configuration.execution.numericalTolerance = tol;
-            dd::ComplexTable<>::setTolerance(tol);
-        }
+        // the tolerance is applied to the decision diagram package for the duration of `run` and of the output permutation
+        // inference (see `ToleranceScope`). Waiting for it counts towards the timeout
+        void setTolerance(dd::fp tol) { configuration.execution.numericalTolerance = tol; }
         void setParallel(bool parallel) { configuration.execution.parallel = parallel; }
         void setNThreads(std::size_t nthreads) { configuration.execution.nthreads = nthreads; }
-        void setTimeout(std::chrono::seconds timeout) { configuration.execution.timeout = timeout; }
+        void setTimeout(std::chrono::milliseconds timeout) { configuration.execution.timeout = timeout; }
         void setConstructionChecker(bool run) { configuration.execution.runConstructionChecker = run; }
         void setSimulationChecker(bool run) { configuration.execution.runSimulationChecker = run; }
         void setAlternatingChecker(bool run) { configuration.execution.runAlternatingChecker = run; }
+        void setDynamicCircuitChecker(bool run) { configuration.execution.runDynamicCircuitChecker = run; }
+        void setReversibleChecker(bool run) { configuration.execution.runReversibleChecker = run; }
+        void setPhasePolynomialChecker(bool run) { configuration.execution.runPhasePolynomialChecker = run; }
 
         // Optimization: Optimizations are applied during initialization. Already configured and applied optimizations cannot be reverted
         void runFixOutputPermutationMismatch();
@@ -166,6 +197,15 @@ namespace ec {
         void storeCEXinput(bool store) { configuration.simulation.storeCEXinput = store; }
         void storeCEXoutput(bool store) { configuration.simulation.storeCEXoutput = store; }
 
+        // Parameterized: These settings may be changed to adjust the check of circuits with symbolic parameters
+        void setNInstantiations(std::size_t instantiations) { configuration.parameterized.nInstantiations = instantiations; }
+
+        // the checkers that are still alive. Unless `retainCheckers` is set, these are released once they are no longer needed
+        [[nodiscard]] const std::vector<std::unique_ptr<EquivalenceChecker>>& getCheckers() const noexcept { return checkers; }
+
+        [[nodiscard]] bool isParameterized() const noexcept { return parameterized; }
+        [[nodiscard]] bool isDynamic() const noexcept { return dynamic; }
+
     protected:
         qc::QuantumComputation qc1{};
         qc::QuantumComputation qc2{};
@@ -175,26 +215,98 @@ namespace ec {
         StateGenerator stateGenerator;
         std::mutex     stateGeneratorMutex{};
 
-        bool                                             done{false};
-        std::condition_variable                          doneCond{};
-        std::mutex                                       doneMutex{};
+        std::atomic<bool>                                done{false};
         std::vector<std::unique_ptr<EquivalenceChecker>> checkers{};
+        // the statistics of all checkers that have already been released
+        std::vector<nlohmann::json> checkerResults{};
+
+        // point in time at which the current check times out (if a timeout is configured)
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        [[nodiscard]] bool                    deadlineReached() const {
+            return deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline;
+        }
 
         Results results{};
 
+        // whether any of the circuits contains operations with symbolic parameters
+        bool parameterized = false;
+        // instantiated copies of the preprocessed circuits that the checkers of a parameterized check operate on
+        std::deque<std::pair<qc::QuantumComputation, qc::QuantumComputation>> instantiatedCircuits{};
+
+        // whether any of the circuits contains dynamic circuit primitives that are checked natively
+        bool dynamic = false;
+
+        std::shared_ptr<OriginalCache> originalCache{};
+
+        // the table shared by all simulation checkers of the current check (if configured)
+        static constexpr std::size_t        SHARED_COMPUTE_TABLE_CAPACITY = 1U << 16U;
+        std::shared_ptr<SharedComputeTable> sharedComputeTable{};
+        /// Create a simulation checker that uses the shared compute table (if any)
+        std::unique_ptr<DDSimulationChecker> createSimulationChecker();
+        // whether the original circuit is `qc1` (the circuits are swapped such that `qc1` has fewer gates)
+        bool originalFirst = true;
+        // the preprocessed original circuit that identifies its cached representations (empty if the cache is not used)
+        std::string originalKey{};
+        // the original circuit together with the parameters the stimuli are generated from (identifies cached output states)
+        std::string stimulusKey{};
+
+        /// Let the given checker reuse the cached final representation of the original circuit in its next run (if available).
+        /// For simulations, `stimulus` is the index of the initial state. Returns whether a cached representation is reused
+        template<class Checker>
+        bool loadOriginal(Checker& checker, std::optional<std::size_t> stimulus);
+        /// Store the final representation of the original circuit computed by the given checker in the cache
+        template<class Checker>
+        void storeOriginal(const Checker& checker, std::optional<std::size_t> stimulus);
+
         /// Given that one circuit has more qubits than the other, the difference is assumed to arise from ancillary qubits.
         /// This function changes the additional qubits in the larger circuit to ancillary qubits.
         /// Furthermore it adds corresponding ancillaries in the smaller circuit
         void setupAncillariesAndGarbage();
 
         /// In some cases both circuits calculate the same function, but on different qubits.
-        /// This function tries to correct such mismatches.
-        /// Note that this is still highly experimental!
+        /// This function infers the permutation between the (non-garbage) outputs of both circuits from basis state simulations
+        /// of U1 U2^-1 (or, for circuits with ancillary qubits, of both circuits separately for stimuli on their non-ancillary
+        /// inputs) and relabels the outputs of the second circuit accordingly.
+        /// If the circuits do not differ by a permutation of their outputs, they are left unchanged.
         void fixOutputPermutationMismatch();
 
+        /// Partial equivalence checking only considers the outputs specified in the configuration.
+        /// All other outputs are marked as garbage in both circuits so that the checkers sum up their contributions
+        /// (for simulations, as soon as the respective qubits are no longer acted upon).
+        void setupRelevantOutputs();
+
         /// Run all configured optimization passes
         void runOptimizationPasses();
 
+        /// Initialize the stimuli generator and limit the number of simulations to the number of unique stimuli
+        void setupStimuli();
+
+        /// Run the configured checks (see `run`, which additionally releases all checkers afterwards)
+        void check();
+
+        /// Keep the statistics of the given checker and free its resources (unless checkers shall be retained)
+        void releaseChecker(std::unique_ptr<EquivalenceChecker>& checker);
+        void releaseCheckers() {
+            for (auto& checker: checkers) {
+                releaseChecker(checker);
+            }
+        }
+
+        /// The deadline of a checker with the given time budget starting at `start`, which never exceeds the overall deadline
+        [[nodiscard]] std::chrono::steady_clock::time_point budgetDeadline(std::chrono::milliseconds budget, std::chrono::steady_clock::time_point start) const {
+            if (budget <= std::chrono::milliseconds::zero()) {
+                return deadline;
+            }
+            return std::min(deadline, start + budget);
+        }
+        /// Record that the time budget with the given name has run out
+        void exhaustBudget(const std::string& budget) {
+            auto& exhausted = results.exhaustedBudgets;
+            if (std::find(exhausted.begin(), exhausted.end(), budget) == exhausted.end()) {
+                exhausted.emplace_back(budget);
+            }
+        }
+
         /// Sequential Equivalence Check (TCAD'21)
         /// First, a couple of simulations with various stimuli are conducted.
         /// If any of those stimuli produce output states with a fidelity not close to 1, the non-equivalence has been shown and the check is finished.
@@ -202,10 +314,40 @@ namespace ec {
         /// To assure this, the alternating decision diagram checker is invoked to determine the equivalence.
         void checkSequential();
 
+        /// Interleaved Equivalence Check
+        /// Same as the sequential check, but the simulation, alternating, and construction checkers are run on a single thread
+        /// in a round-robin fashion, each for a time slice at a time. The first conclusive result settles the check.
+        void checkInterleaved();
+
+        /// Reversible Equivalence Check
+        /// Circuits that only consist of (multi-)controlled X and SWAP gates are compared via their truth tables using bit-parallel simulation.
+        /// An exhaustive comparison or a counterexample settles the equivalence. Otherwise, the circuits are considered probably equivalent
+        /// and the remaining checkers are run.
+        void checkReversible();
+
+        /// Phase Polynomial Equivalence Check
+        /// Circuits that only consist of X, CNOT, SWAP, and (singly-controlled) phase gates are compared via their affine parts over GF(2)
+        /// and their phase polynomials. Any conclusive result settles the equivalence. Otherwise, the remaining checkers are run.
+        void checkPhasePolynomial();
+
         /// Parallel Equivalence Check
         /// The parallel flow makes use of the available processing power by orchestrating all configured checks in a parallel fashion
         void checkParallel();
 
+        /// Parameterized Equivalence Check
+        /// Circuits with symbolic parameters are first checked by the alternating checker for a random instantiation of all variables.
+        /// Whenever all symbolic operations cancel out during this check, the result holds for every instantiation and the check is finished.
+        /// Otherwise, further random instantiations of the (already preprocessed) circuits are checked in parallel.
+        /// If none of them shows the non-equivalence, the circuits are considered probably equivalent.
+        void checkParameterized();
+
+        /// Dynamic Circuit Equivalence Check
+        /// Circuits containing mid-circuit measurements, resets, or classically-controlled operations are simulated natively
+        /// for a number of random stimuli while branching over all measurement outcomes.
+        /// If any stimulus yields different outcome distributions or states, the circuits are not equivalent.
+        /// Otherwise, they are considered probably equivalent.
+        void checkDynamicCircuits();
+
         /// Signal all checker that they shall abort the computation as soon as possible since a result has been determined
         void setAndSignalDone() {
             done = true;
@@ -0,0 +1,54 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "checker/dd/simulation/StateType.hpp"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace ec {
+    // Cache for the final representations of an original circuit that is checked against many compiled circuits.
+    // A manager that has been given the cache reuses the output states of the original circuit for its simulations and
+    // the functionality of the original circuit for the construction checker, so that only the compiled circuit has to be processed.
+    // Entries are identified by the preprocessed original circuit, i.e., they are only reused if the preprocessing (which may
+    // depend on the compiled circuit, e.g., due to ancillary qubits) results in exactly the same circuit.
+    // Output states are only cached for a fixed seed, since only then the same stimuli are generated. Since the stimuli also
+    // depend on the number of (ancillary) qubits of the circuit with fewer gates, these are part of the key of output states.
+    // The cache may be shared by managers running concurrently.
+    class OriginalCache {
+    public:
+        // the serialized output state of the original circuit for the `index`-th stimulus generated with the given seed and type
+        [[nodiscard]] std::optional<std::string> getState(const std::string& original, std::size_t seed, StateType type, std::size_t index);
+        void                                     storeState(const std::string& original, std::size_t seed, StateType type, std::size_t index, std::string state);
+
+        // the serialized functionality of the original circuit
+        [[nodiscard]] std::optional<std::string> getFunctionality(const std::string& original);
+        void                                     storeFunctionality(const std::string& original, std::string functionality);
+
+        [[nodiscard]] std::size_t getHits() const;
+        [[nodiscard]] std::size_t getMisses() const;
+        void                      clear();
+
+    protected:
+        using Stimulus = std::tuple<std::size_t, StateType, std::size_t>;
+
+        struct Entry {
+            std::map<Stimulus, std::string> states{};
+            std::optional<std::string>      functionality{};
+        };
+
+        mutable std::mutex                     mutex{};
+        std::unordered_map<std::string, Entry> entries{};
+        std::size_t                            hits{};
+        std::size_t                            misses{};
+    };
+} // namespace ec
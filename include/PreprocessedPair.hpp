@@ -0,0 +1,53 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "Configuration.hpp"
+#include "QuantumComputation.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace ec {
+    // A pair of circuits as it results from the preprocessing of the `EquivalenceCheckingManager`, i.e., after all
+    // optimization passes have been applied, idle qubits have been stripped, and ancillary and garbage qubits have been set up.
+    // The preprocessed pair can be stored in a compact binary format and a manager can be constructed directly from it,
+    // which allows to preprocess a pair once and to check it with many different configurations (or in different processes).
+    //
+    // The binary format consists of fixed-width fields in the byte order of the host (which is checked upon reading):
+    //   header:  magic "QCECPAIR" | version (u32) | byte order mark (u32) | flags (u32) | optimizations (u32) | relevant outputs
+    //   circuit: name | #qubits (u32) | #ancillae (u32) | #classical bits (u64) | initial layout | output permutation |
+    //            ancillary flags | garbage flags | #operations (u64) | operations
+    // for both circuits. Operations are stored recursively (compound and classically-controlled operations).
+    // Since the data is parsed in place, it can be read directly from a memory-mapped file.
+    // Circuits with symbolic parameters are not supported.
+    struct PreprocessedPair {
+        static constexpr std::uint32_t VERSION = 1U;
+
+        qc::QuantumComputation qc1{};
+        qc::QuantumComputation qc2{};
+
+        // whether the circuits contain dynamic circuit primitives that are checked natively
+        bool dynamic = false;
+
+        // the options that have been used during preprocessing
+        Configuration::Optimizations      optimizations{};
+        Configuration::PartialEquivalence partialEquivalence{};
+
+        [[nodiscard]] PreprocessedPair clone() const;
+
+        void                      write(std::ostream& os) const;
+        void                      write(const std::string& filename) const;
+        [[nodiscard]] std::string serialize() const;
+        // the binary representation of a single circuit (e.g., to identify identically preprocessed circuits)
+        [[nodiscard]] static std::string serialize(const qc::QuantumComputation& qc);
+
+        [[nodiscard]] static PreprocessedPair read(const char* data, std::size_t size);
+        // memory-maps the given file (where supported) and reads the pair from it
+        [[nodiscard]] static PreprocessedPair read(const std::string& filename);
+    };
+} // namespace ec
@@ -0,0 +1,37 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace ec {
+    // The resources available to the process. Within containers, the number of hardware threads reported by the system
+    // usually is that of the host, while the process is restricted by the CPU quota and memory limit of its control group.
+    // These are read from cgroup v2 (`cpu.max`, `memory.max`) or cgroup v1 (`cpu.cfs_quota_us`, `memory.limit_in_bytes`).
+    struct Resources {
+        // the number of hardware threads the process may be scheduled on
+        std::size_t hardwareThreads = 1U;
+        // the number of CPUs granted by the CPU quota (if limited)
+        std::optional<double> cpuQuota{};
+        // the memory limit in bytes (if limited)
+        std::optional<std::size_t> memoryLimit{};
+
+        // the number of threads that may run concurrently without being throttled, minus `reserved` ones (at least 1)
+        [[nodiscard]] std::size_t threads(std::size_t reserved = 0U) const noexcept;
+
+        [[nodiscard]] nlohmann::json json() const;
+
+        // the resources of the current process (determined once)
+        static const Resources& get();
+
+        // determine the resources from the cgroup file system mounted at the given root
+        static Resources detect(const std::string& cgroupRoot = "/sys/fs/cgroup");
+    };
+} // namespace ec
@@ -0,0 +1,32 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "dd/Definitions.hpp"
+
+#include <chrono>
+
+namespace ec {
+    // The numerical tolerance of the decision diagram package is a process-wide setting. A scope applies the tolerance of a
+    // single check for as long as it is alive. Any number of scopes with the same tolerance may be active at the same time
+    // (e.g., managers checking different circuits concurrently), while a scope with a different tolerance waits until all
+    // active scopes have been left. Scopes are entered in the order of their arrival, i.e., a scope never overtakes a
+    // waiting one (even if it uses the currently applied tolerance).
+    // If the deadline passes before the scope could be entered, it gives up waiting and is not `acquired`.
+    class ToleranceScope {
+    public:
+        explicit ToleranceScope(dd::fp tolerance, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+        ~ToleranceScope();
+
+        ToleranceScope(const ToleranceScope&)            = delete;
+        ToleranceScope& operator=(const ToleranceScope&) = delete;
+
+        [[nodiscard]] bool acquired() const noexcept { return entered; }
+
+    private:
+        bool entered = false;
+    };
+} // namespace ec
@@ -10,6 +10,7 @@
 #include "QuantumComputation.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <utility>
 
 namespace ec {
@@ -24,6 +25,14 @@ namespace ec {
 
         virtual EquivalenceCriterion run() = 0;
 
+        // Resumable execution for interleaving several checkers on a single thread. Each call continues the check for
+        // (roughly) the given time slice and returns whether it has finished. Once finished, the next call starts a new check.
+        // Checkers that cannot be interrupted run to completion.
+        virtual bool resume([[maybe_unused]] std::chrono::steady_clock::duration slice) {
+            run();
+            return true;
+        }
+
         [[nodiscard]] const Configuration& getConfiguration() const noexcept {
             return configuration;
         }
@@ -42,7 +51,21 @@ namespace ec {
         void signalDone() {
             done.store(true, std::memory_order_relaxed);
         }
-        inline auto isDone() { return done.load(std::memory_order_relaxed); }
+        // the checker considers itself done as soon as the deadline has passed
+        void setDeadline(std::chrono::steady_clock::time_point time) {
+            deadline.store(time, std::memory_order_relaxed);
+        }
+        inline bool isDone() {
+            if (done.load(std::memory_order_relaxed)) {
+                return true;
+            }
+            const auto time = deadline.load(std::memory_order_relaxed);
+            if (time != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= time) {
+                signalDone();
+                return true;
+            }
+            return false;
+        }
 
     protected:
         const qc::QuantumComputation& qc1;
@@ -52,7 +75,8 @@ namespace ec {
 
         Configuration configuration;
 
-        std::atomic<bool> done{false};
+        std::atomic<bool>                                  done{false};
+        std::atomic<std::chrono::steady_clock::time_point> deadline{std::chrono::steady_clock::time_point::max()};
 
         EquivalenceCriterion equivalence = EquivalenceCriterion::NoInformation;
         double               runtime{};
@@ -0,0 +1,76 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "checker/EquivalenceChecker.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
+#include "checker/dd/LevelPermutation.hpp"
+#include "checker/dd/simulation/StateGenerator.hpp"
+#include "dd/Operations.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace ec {
+    // Simulation-based checker that natively supports dynamic circuit primitives (mid-circuit measurements, resets, and
+    // classically-controlled operations). Instead of transforming the circuits (which adds a qubit per reset), the
+    // simulation branches over measurement outcomes while tracking the probability of each branch.
+    // Branches that end up with the same classical values and the same state are merged, so that the number of branches
+    // (and, hence, the memory requirements) grows with the number of distinct outcomes rather than the number of resets.
+    // All branches live in the same package and, thus, share common decision diagram substructures.
+    //
+    // Two circuits are considered equivalent for a given stimulus if they produce the same distribution of classical
+    // outcomes and, for each outcome, the same (mixed) state on all qubits that are neither garbage nor hold the result of
+    // a measurement or reset (that has not been acted upon afterwards) in both circuits.
+    class DDDynamicCircuitChecker: public EquivalenceChecker {
+    public:
+        DDDynamicCircuitChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration);
+
+        EquivalenceCriterion run() override;
+
+        void setRandomInitialState(StateGenerator& generator);
+
+        void json(nlohmann::json& j) const noexcept override {
+            EquivalenceChecker::json(j);
+            j["checker"]      = "decision_diagram_dynamic_circuit";
+            j["max_nodes"]    = maxActiveNodes;
+            j["max_branches"] = maxBranches;
+        }
+
+    protected:
+        struct Branch {
+            std::vector<bool> classicalValues{};
+            qc::VectorDD      state{};
+            dd::fp            probability = 1.;
+        };
+
+        std::unique_ptr<SimulationDDPackage> dd;
+
+        // the initial state used for simulation. defaults to the all-zero state |0...0>
+        qc::VectorDD initialState{};
+
+        std::size_t maxActiveNodes{};
+        std::size_t maxBranches{};
+
+        // simulate the circuit starting from the initial state and return all resulting branches. `observed` marks the
+        // outputs that hold the result of a measurement or reset at the end of the circuit
+        std::vector<Branch> simulate(const qc::QuantumComputation& qc, std::vector<bool>& observed);
+
+        void apply(const qc::MatrixDD& op, Branch& branch);
+        void measure(std::vector<Branch>& branches, dd::Qubit level, std::size_t bit);
+        void reset(std::vector<Branch>& branches, dd::Qubit level);
+        void mergeBranches(std::vector<Branch>& branches);
+
+        // project the state onto the given outcome for the qubit at the given level (moving it to |0> if requested)
+        qc::VectorDD project(const qc::VectorDD& state, dd::Qubit level, bool outcome, dd::fp probability, bool reset);
+        dd::fp       outcomeProbability(const qc::VectorDD& state, dd::Qubit level, bool outcome);
+
+        // compare the ensembles of both circuits on all qubits that are neither garbage nor observed
+        EquivalenceCriterion compare(std::vector<Branch>& branches1, std::vector<Branch>& branches2, const std::vector<bool>& observed);
+    };
+} // namespace ec
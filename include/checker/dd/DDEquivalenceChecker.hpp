@@ -18,10 +18,12 @@
 #include "applicationscheme/SequentialApplicationScheme.hpp"
 #include "checker/EquivalenceChecker.hpp"
 #include "checker/dd/DDPackageConfigs.hpp"
+#include "dd/Export.hpp"
 
 #include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -32,10 +34,29 @@ namespace ec {
         DDEquivalenceChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, Configuration configuration) noexcept;
 
         EquivalenceCriterion run() override;
+        bool                 resume(std::chrono::steady_clock::duration slice) override;
+
+        // whether the obtained result holds for every instantiation of symbolic parameters,
+        // i.e., no operation depending on a variable has been applied to the internal representation
+        [[nodiscard]] bool isParameterIndependent() const noexcept {
+            return !taskManager1.usedParameterizedOperations() && !taskManager2.usedParameterizedOperations();
+        }
+
+        // Reuse the final representation of one of the circuits (e.g., of an original circuit that is checked against many
+        // compiled circuits) in the next run instead of computing it again. The representation has to be obtained from
+        // `getFinalRepresentation` of a checker of the same kind for an identically preprocessed circuit (and initial state).
+        void setFinalRepresentation(bool first, std::string representation) {
+            cachedRepresentation = std::pair{first, std::move(representation)};
+        }
+        // the serialized representation of the given circuit after all postprocessing. Only valid directly after `run`
+        [[nodiscard]] std::string getFinalRepresentation(bool first) const;
 
         void json(nlohmann::json& j) const noexcept override {
             EquivalenceChecker::json(j);
             j["max_nodes"] = maxActiveNodes;
+            if (reusedRepresentations > 0U) {
+                j["reused_representations"] = reusedRepresentations;
+            }
         }
 
     protected:
@@ -48,10 +69,34 @@ namespace ec {
 
         std::size_t maxActiveNodes{};
 
+        // the stage a resumable check (see `resume`) continues with
+        enum class Stage { Initialize,
+                           Execute,
+                           Finish,
+                           Compare,
+                           Done };
+        Stage stage = Stage::Done;
+        // point in time at which the current time slice ends
+        std::chrono::steady_clock::time_point sliceEnd = std::chrono::steady_clock::time_point::max();
+        // whether the current time slice has ended. This is only checked after some progress has been made in a time slice
+        [[nodiscard]] inline bool sliceEnded() const {
+            return sliceEnd != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= sliceEnd;
+        }
+        // continue the check from the current stage until it finishes or the time slice ends. Returns whether the check finished
+        bool proceed();
+
+        // the representation that replaces the computation of one of the circuits in the next run
+        std::optional<std::pair<bool, std::string>> cachedRepresentation{};
+        // the task whose final representation has been reused in the current run (if any)
+        const TaskManager<DDType, DDPackage>* reusedTask = nullptr;
+        std::size_t                           reusedRepresentations{};
+
         void initializeApplicationScheme(ApplicationSchemeType scheme);
 
         // at some point this routine should probably make its way into the DD package in some form
         EquivalenceCriterion equals(const DDType& e, const DDType& f);
+        // the equivalence of two states given their inner product
+        [[nodiscard]] EquivalenceCriterion fromInnerProduct(const dd::ComplexValue& innerProduct) const;
 
         virtual void                 initializeTask(TaskManager<DDType, DDPackage>&) = 0;
         virtual void                 initialize();
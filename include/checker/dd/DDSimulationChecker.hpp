@@ -6,6 +6,10 @@
 #pragma once
 
 #include "DDEquivalenceChecker.hpp"
+#include "checker/dd/simulation/SharedComputeTable.hpp"
+
+#include <memory>
+#include <optional>
 
 namespace ec {
     class DDSimulationChecker: public DDEquivalenceChecker<qc::VectorDD, SimulationDDPackage> {
@@ -14,20 +18,68 @@ namespace ec {
 
         void setRandomInitialState(StateGenerator& generator);
 
+        // share the gate applications of both circuits with all other checkers using the same table
+        void setSharedComputeTable(std::shared_ptr<SharedComputeTable> table);
+
+        EquivalenceCriterion run() override;
+        // concurrent and inverse simulations are not interrupted
+        bool resume(std::chrono::steady_clock::duration slice) override;
+
         [[nodiscard]] dd::CVec getInitialVector() const { return dd->getVector(initialState); }
         [[nodiscard]] dd::CVec getInternalVector1() const { return dd->getVector(taskManager1.getInternalState()); }
-        [[nodiscard]] dd::CVec getInternalVector2() const { return dd->getVector(taskManager2.getInternalState()); }
+        [[nodiscard]] dd::CVec getInternalVector2() const {
+            if (concurrentRun) {
+                return concurrentDD->getVector(concurrentTask.getInternalState());
+            }
+            return dd->getVector(taskManager2.getInternalState());
+        }
+
+        // in concurrent simulations, the final state of the second circuit resides in a separate package.
+        // Inverse simulations do not provide any final representation (an empty string is returned)
+        [[nodiscard]] std::string getFinalRepresentation(bool first) const;
 
         void json(nlohmann::json& j) const noexcept override {
             DDEquivalenceChecker::json(j);
             j["checker"] = "decision_diagram_simulation";
+            if (configuration.simulation.concurrent) {
+                j["concurrent"] = true;
+            }
+            if (configuration.simulation.inverse) {
+                j["inverse"] = invertible;
+            }
         }
 
     protected:
         // the initial state used for simulation. defaults to the all-zero state |0...0>
         qc::VectorDD initialState{};
 
+        // for concurrent simulations, the second circuit is simulated using a separate package
+        std::unique_ptr<SimulationDDPackage>             concurrentDD{};
+        TaskManager<qc::VectorDD, SimulationDDPackage> concurrentTask;
+        // whether the last run simulated both circuits concurrently
+        bool concurrentRun = false;
+        // whether the simulation can be inverted, i.e., neither circuit has garbage qubits
+        bool invertible = false;
+        // whether the last run simulated the inverse of the second circuit
+        bool inverseRun = false;
+
+        // the view of this checker's package on the table shared with other checkers (if any)
+        std::optional<SharedComputeTable::Client> sharedTable{};
+
         void                 initializeTask(TaskManager<qc::VectorDD, SimulationDDPackage>& task) override;
         EquivalenceCriterion checkEquivalence() override;
+
+        // determine whether the next run is a concurrent or an inverse simulation
+        void selectMode();
+
+        // simulate both circuits on separate threads and compare the resulting states across both packages
+        EquivalenceCriterion runConcurrently();
+        void                 simulate(TaskManager<qc::VectorDD, SimulationDDPackage>& task);
+
+        // simulate the first circuit followed by the inverse of the second one and compare the result to the initial state.
+        // In this case, the internal vectors of both tasks hold the final and the initial state, respectively
+        EquivalenceCriterion runInverse();
+        // apply the inverse of the second circuit (i.e., its inverted operations in reverse order) to the given state
+        void applyInverse(qc::VectorDD& state);
     };
 } // namespace ec
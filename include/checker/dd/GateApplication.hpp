@@ -0,0 +1,345 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "dd/Package.hpp"
+
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ec {
+    // the 2x2 matrix of a (multi-)controlled single-target operation or `std::nullopt` if the operation has no such representation
+    [[nodiscard]] inline std::optional<dd::GateMatrix> singleTargetGateMatrix(const qc::Operation& op) {
+        if (!op.isStandardOperation() || op.getNtargets() != 1U) {
+            return std::nullopt;
+        }
+        const auto& parameter = op.getParameter();
+        switch (op.getType()) {
+            case qc::I: return dd::Imat;
+            case qc::H: return dd::Hmat;
+            case qc::X: return dd::Xmat;
+            case qc::Y: return dd::Ymat;
+            case qc::Z: return dd::Zmat;
+            case qc::S: return dd::Smat;
+            case qc::Sdag: return dd::Sdagmat;
+            case qc::T: return dd::Tmat;
+            case qc::Tdag: return dd::Tdagmat;
+            case qc::V: return dd::Vmat;
+            case qc::Vdag: return dd::Vdagmat;
+            case qc::SX: return dd::SXmat;
+            case qc::SXdag: return dd::SXdagmat;
+            case qc::U3: return dd::U3mat(parameter[0], parameter[1], parameter[2]);
+            case qc::U2: return dd::U2mat(parameter[0], parameter[1]);
+            case qc::Phase: return dd::Phasemat(parameter[0]);
+            case qc::RX: return dd::RXmat(parameter[0]);
+            case qc::RY: return dd::RYmat(parameter[0]);
+            case qc::RZ: return dd::RZmat(parameter[0]);
+            default: return std::nullopt;
+        }
+    }
+
+    // Apply a (multi-)controlled single-target gate directly to a vector or matrix decision diagram.
+    // In contrast to constructing the n-qubit DD of the gate and multiplying it with the given DD, the recursion only
+    // descends along the (active) control levels down to the target level. All sub-diagrams that are not acted upon
+    // are reused as they are.
+    // For matrices, `regular` determines whether the gate is applied from the left (i.e., to the rows) or its inverse
+    // is applied from the right (i.e., to the columns).
+    template<class Node, class DDPackage>
+    class GateApplication {
+    public:
+        using Edge = dd::Edge<Node>;
+
+        // `target` and the `controls` refer to levels of the decision diagram
+        GateApplication(std::unique_ptr<DDPackage>& dd, const dd::GateMatrix& matrix, dd::Qubit target, const dd::Controls& controls, bool regular = true):
+            dd(dd), matrix(matrix), target(target), regular(regular) {
+            for (const auto& control: controls) {
+                const auto active = control.type == dd::Control::Type::pos ? 1U : 0U;
+                if (control.qubit > target) {
+                    above.emplace(control.qubit, active);
+                } else {
+                    below.emplace(control.qubit, active);
+                }
+            }
+            diagonal = std::abs(matrix[1].r) == 0. && std::abs(matrix[1].i) == 0. && std::abs(matrix[2].r) == 0. && std::abs(matrix[2].i) == 0.;
+            if (diagonal) {
+                factors = {dd->cn.lookup(coefficient(0U, 0U)), dd->cn.lookup(coefficient(1U, 1U))};
+            }
+        }
+
+        Edge operator()(const Edge& e) {
+            if (e.w.approximatelyZero()) {
+                return e;
+            }
+            const auto root = expand(e, above.empty() ? target : above.rbegin()->first);
+            if (diagonal) {
+                return scale(applyDiagonal(root.p, 0U), root.w);
+            }
+            return scale(apply(root.p), root.w);
+        }
+
+    private:
+        static constexpr std::size_t NEDGE    = std::tuple_size_v<decltype(Node::e)>;
+        static constexpr bool        isMatrix = std::is_same_v<Node, dd::mNode>;
+        // number of indices of a node that are not acted upon (i.e., the columns for `regular` matrices)
+        static constexpr std::size_t NOTHER = isMatrix ? 2U : 1U;
+
+        std::unique_ptr<DDPackage>& dd;
+        dd::GateMatrix              matrix;
+        dd::Qubit                   target;
+        bool                        regular;
+        // control levels above and below the target together with the value they have to take
+        std::map<dd::Qubit, std::size_t> above{};
+        std::map<dd::Qubit, std::size_t> below{};
+
+        std::unordered_map<Node*, Edge> applied{};
+        std::unordered_map<Node*, Edge> projected{};
+
+        // diagonal gates (e.g., Phase, RZ, S, T, and Z) are applied by rescaling the edges at the lowest involved level (see `applyDiagonal`)
+        bool                                            diagonal = false;
+        std::array<dd::Complex, 2U>                     factors{};
+        std::array<std::unordered_map<Node*, Edge>, 2U> diagonalApplied{};
+
+        [[nodiscard]] static dd::Qubit levelOf(const Edge& e) {
+            return e.isTerminal() ? static_cast<dd::Qubit>(-1) : e.p->v;
+        }
+
+        // the bit of the index `i` of a node's edges that is acted upon
+        [[nodiscard]] std::size_t actingBit(std::size_t i) const {
+            if constexpr (isMatrix) {
+                return regular ? i / 2U : i % 2U;
+            } else {
+                return i;
+            }
+        }
+        [[nodiscard]] std::size_t index(std::size_t acting, std::size_t other) const {
+            if constexpr (isMatrix) {
+                return regular ? 2U * acting + other : 2U * other + acting;
+            } else {
+                return acting;
+            }
+        }
+        // the factor with which the entry at `from` contributes to the entry at `to`. Applying the inverse from the right
+        // amounts to applying the complex conjugate of the gate to the columns
+        [[nodiscard]] dd::ComplexValue coefficient(std::size_t to, std::size_t from) const {
+            const auto& c = matrix[2U * to + from];
+            if (isMatrix && !regular) {
+                return {c.r, -c.i};
+            }
+            return c;
+        }
+
+        // the highest level of the given levels that is lower than `level` (or -1 if there is none)
+        [[nodiscard]] static dd::Qubit next(const std::map<dd::Qubit, std::size_t>& levels, dd::Qubit level) {
+            const auto it = levels.lower_bound(level);
+            return it == levels.begin() ? static_cast<dd::Qubit>(-1) : std::prev(it)->first;
+        }
+        [[nodiscard]] dd::Qubit nextAbove(dd::Qubit level) const {
+            const auto control = next(above, level);
+            return control < 0 ? target : control;
+        }
+        // the highest level lower than `level` that is acted upon (i.e., a control or the target) or -1 if there is none
+        [[nodiscard]] dd::Qubit nextInvolved(dd::Qubit level) const {
+            if (level > target) {
+                return nextAbove(level);
+            }
+            return next(below, level);
+        }
+
+        dd::Complex multiply(const dd::Complex& a, const dd::Complex& b) {
+            if (a.approximatelyZero() || b.approximatelyZero()) {
+                return dd::Complex::zero;
+            }
+            if (a == dd::Complex::one) {
+                return b;
+            }
+            if (b == dd::Complex::one) {
+                return a;
+            }
+            auto c = dd->cn.getCached();
+            dd::ComplexNumbers::mul(c, a, b);
+            const auto result = dd->cn.lookup(c);
+            dd->cn.returnToCache(c);
+            return result;
+        }
+        Edge scale(const Edge& e, const dd::Complex& w) {
+            if (e.w.approximatelyZero() || w.approximatelyZero()) {
+                return Edge::zero;
+            }
+            return {e.p, multiply(e.w, w)};
+        }
+        Edge scale(const Edge& e, const dd::ComplexValue& w) {
+            return scale(e, dd->cn.lookup(w));
+        }
+        Edge add(const Edge& a, const Edge& b) {
+            if (a.w.approximatelyZero()) {
+                return b;
+            }
+            if (b.w.approximatelyZero()) {
+                return a;
+            }
+            return dd->add(a, b);
+        }
+
+        // levels may only be skipped by matrices (where a skipped level corresponds to the identity).
+        // make these levels explicit up to (and including) `to`
+        Edge expand(Edge e, dd::Qubit to) {
+            if constexpr (isMatrix) {
+                if (e.w.approximatelyZero() || levelOf(e) >= to) {
+                    return e;
+                }
+                const auto w = e.w;
+                e.w          = dd::Complex::one;
+                for (auto v = static_cast<dd::Qubit>(levelOf(e) + 1); v <= to; ++v) {
+                    e = dd->makeDDNode(v, std::array<Edge, NEDGE>{e, Edge::zero, Edge::zero, e});
+                }
+                e.w = w;
+            }
+            return e;
+        }
+
+        // the result of applying the gate to the DD represented by node `p` (with unit weight), where `p` is at least at the target level
+        Edge apply(Node* p) {
+            if (const auto it = applied.find(p); it != applied.end()) {
+                return it->second;
+            }
+
+            std::array<Edge, NEDGE> edges{};
+            if (p->v > target) {
+                const auto control = above.find(p->v);
+                const auto lower   = nextAbove(p->v);
+                for (std::size_t i = 0U; i < NEDGE; ++i) {
+                    const auto& child = p->e[i];
+                    // inactive control branches remain untouched
+                    if (child.w.approximatelyZero() || (control != above.end() && actingBit(i) != control->second)) {
+                        edges[i] = child;
+                        continue;
+                    }
+                    const auto e = expand(child, lower);
+                    edges[i]     = scale(apply(e.p), e.w);
+                }
+            } else {
+                std::array<Edge, NEDGE> children{};
+                for (std::size_t i = 0U; i < NEDGE; ++i) {
+                    children[i] = expand(p->e[i], static_cast<dd::Qubit>(target - 1));
+                }
+                for (std::size_t other = 0U; other < NOTHER; ++other) {
+                    for (std::size_t to = 0U; to < 2U; ++to) {
+                        auto& result = edges[index(to, other)];
+                        if (below.empty()) {
+                            result = Edge::zero;
+                            for (std::size_t from = 0U; from < 2U; ++from) {
+                                result = add(result, scale(children[index(from, other)], coefficient(to, from)));
+                            }
+                        } else {
+                            // only the part of the sub-diagrams in which all lower controls are active is transformed
+                            result = children[index(to, other)];
+                            for (std::size_t from = 0U; from < 2U; ++from) {
+                                auto c = coefficient(to, from);
+                                if (to == from) {
+                                    c.r -= 1.;
+                                }
+                                if (std::abs(c.r) < dd::ComplexTable<>::tolerance() && std::abs(c.i) < dd::ComplexTable<>::tolerance()) {
+                                    continue;
+                                }
+                                result = add(result, scale(project(children[index(from, other)], below.rbegin()->first), c));
+                            }
+                        }
+                    }
+                }
+            }
+
+            const auto result = dd->makeDDNode(p->v, edges);
+            applied.emplace(p, result);
+            return result;
+        }
+
+        // the result of applying the diagonal gate to the DD represented by node `p` (with unit weight). Since the gate is
+        // diagonal, only the edges at the lowest involved level are rescaled (by the factor corresponding to the value `bit`
+        // of the target) and all nodes in between are merely rebuilt.
+        Edge applyDiagonal(Node* p, std::size_t bit) {
+            auto& computed = diagonalApplied[bit];
+            if (const auto it = computed.find(p); it != computed.end()) {
+                return it->second;
+            }
+
+            const auto&             controls  = p->v > target ? above : below;
+            const auto              control   = controls.find(p->v);
+            const auto              isControl = control != controls.end();
+            const auto              lower     = nextInvolved(p->v);
+            std::array<Edge, NEDGE> edges{};
+            for (std::size_t i = 0U; i < NEDGE; ++i) {
+                const auto& child = p->e[i];
+                if (child.w.approximatelyZero() || (isControl && actingBit(i) != control->second)) {
+                    edges[i] = child;
+                    continue;
+                }
+                const auto b = p->v == target ? actingBit(i) : bit;
+                if (lower < 0) {
+                    edges[i] = scale(child, factors[b]);
+                    continue;
+                }
+                const auto e = expand(child, lower);
+                edges[i]     = scale(applyDiagonal(e.p, b), e.w);
+            }
+
+            const auto result = dd->makeDDNode(p->v, edges);
+            computed.emplace(p, result);
+            return result;
+        }
+
+        // restrict the given DD (whose levels are made explicit down to `level`) to the part in which all lower controls are active
+        Edge project(const Edge& e, dd::Qubit level) {
+            const auto expanded = expand(e, level);
+            if (expanded.w.approximatelyZero() || expanded.isTerminal() || expanded.p->v < below.begin()->first) {
+                return expanded;
+            }
+            auto* p = expanded.p;
+            if (const auto it = projected.find(p); it != projected.end()) {
+                return scale(it->second, expanded.w);
+            }
+
+            std::array<Edge, NEDGE> edges{};
+            const auto              control = below.find(p->v);
+            const auto              lower   = next(below, p->v);
+            for (std::size_t i = 0U; i < NEDGE; ++i) {
+                const auto& child = p->e[i];
+                if (child.w.approximatelyZero() || (control != below.end() && actingBit(i) != control->second)) {
+                    edges[i] = Edge::zero;
+                    continue;
+                }
+                edges[i] = lower < 0 ? child : project(child, lower);
+            }
+            const auto result = dd->makeDDNode(p->v, edges);
+            projected.emplace(p, result);
+            return scale(result, expanded.w);
+        }
+    };
+
+    // Apply the given operation to the decision diagram `on` (w.r.t. the given permutation) using a dedicated kernel.
+    // Returns false (without touching `on`) if the operation is not a (multi-)controlled single-target gate.
+    // Reference counting is left to the caller.
+    template<class DDType, class DDPackage>
+    bool applySingleTargetGate(DDType& on, const qc::Operation& op, const qc::Permutation& permutation, std::unique_ptr<DDPackage>& dd, bool regular = true) {
+        const auto matrix = singleTargetGateMatrix(op);
+        if (!matrix) {
+            return false;
+        }
+        dd::Controls controls{};
+        for (const auto& control: op.getControls()) {
+            controls.emplace(dd::Control{permutation.at(control.qubit), control.type});
+        }
+        GateApplication<std::remove_pointer_t<decltype(on.p)>, DDPackage> application(dd, *matrix, permutation.at(op.getTargets().front()), controls, regular);
+        on = application(on);
+        return true;
+    }
+} // namespace ec
@@ -0,0 +1,245 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "dd/Package.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ec {
+    // Move the data at each level `l` of a decision diagram to level `target[l]` in a single pass. No SWAP matrices are
+    // created and no multiplication is performed.
+    // The result is built top-down: the edges of the node at level `k` are obtained by fixing the variable that is moved to
+    // level `k` in the original decision diagram. A node of the original decision diagram is only descended into once the
+    // variables at its level are fixed. Hence, a sub-diagram of the result is determined by a node of the original decision
+    // diagram and the values fixed below it, which is used to reuse sub-diagrams (as in a compute table).
+    // For matrices, `regular` determines whether the rows (i.e., the output side) or the columns are permuted.
+    template<class Node, class DDPackage>
+    class LevelPermutation {
+    public:
+        using Edge = dd::Edge<Node>;
+
+        LevelPermutation(std::unique_ptr<DDPackage>& dd, const std::vector<dd::Qubit>& target, bool regular):
+            dd(dd), regular(regular), source(target.size()), rows(target.size(), -1), columns(target.size(), -1) {
+            for (std::size_t l = 0U; l < target.size(); ++l) {
+                source.at(static_cast<std::size_t>(target[l])) = static_cast<dd::Qubit>(l);
+            }
+        }
+
+        Edge operator()(const Edge& e) {
+            if (e.w.approximatelyZero()) {
+                return e;
+            }
+            // levels that are not covered by the permutation stay where they are
+            for (auto l = static_cast<dd::Qubit>(source.size()); l <= levelOf(e); ++l) {
+                source.emplace_back(l);
+                rows.emplace_back(-1);
+                columns.emplace_back(-1);
+            }
+            return build(static_cast<dd::Qubit>(source.size() - 1U), expand(e, static_cast<dd::Qubit>(source.size() - 1U)));
+        }
+
+    private:
+        static constexpr std::size_t NEDGE    = std::tuple_size_v<decltype(Node::e)>;
+        static constexpr bool        isMatrix = std::is_same_v<Node, dd::mNode>;
+
+        std::unique_ptr<DDPackage>& dd;
+        bool                        regular;
+        // the level of the original decision diagram whose data is moved to each level
+        std::vector<dd::Qubit> source;
+        // the values fixed for the variables at each level of the original decision diagram (-1 if not fixed yet).
+        // For vectors, only `rows` is used
+        std::vector<std::int8_t> rows;
+        std::vector<std::int8_t> columns;
+
+        std::unordered_map<Node*, std::map<std::vector<std::int8_t>, Edge>> computed{};
+
+        [[nodiscard]] static dd::Qubit levelOf(const Edge& e) {
+            return e.isTerminal() ? static_cast<dd::Qubit>(-1) : e.p->v;
+        }
+
+        dd::Complex multiply(const dd::Complex& a, const dd::Complex& b) {
+            if (a.approximatelyZero() || b.approximatelyZero()) {
+                return dd::Complex::zero;
+            }
+            if (a == dd::Complex::one) {
+                return b;
+            }
+            if (b == dd::Complex::one) {
+                return a;
+            }
+            auto c = dd->cn.getCached();
+            dd::ComplexNumbers::mul(c, a, b);
+            const auto result = dd->cn.lookup(c);
+            dd->cn.returnToCache(c);
+            return result;
+        }
+
+        // levels may only be skipped by matrices (where a skipped level corresponds to the identity).
+        // make these levels explicit up to (and including) `to`
+        Edge expand(Edge e, dd::Qubit to) {
+            if constexpr (isMatrix) {
+                if (e.w.approximatelyZero() || levelOf(e) >= to) {
+                    return e;
+                }
+                const auto w = e.w;
+                e.w          = dd::Complex::one;
+                for (auto v = static_cast<dd::Qubit>(levelOf(e) + 1); v <= to; ++v) {
+                    e = dd->makeDDNode(v, std::array<Edge, NEDGE>{e, Edge::zero, Edge::zero, e});
+                }
+                e.w = w;
+            }
+            return e;
+        }
+
+        [[nodiscard]] bool isFixed(dd::Qubit v) const {
+            const auto l = static_cast<std::size_t>(v);
+            if constexpr (isMatrix) {
+                return rows[l] >= 0 && columns[l] >= 0;
+            } else {
+                return rows[l] >= 0;
+            }
+        }
+
+        [[nodiscard]] std::size_t fixedIndex(dd::Qubit v) const {
+            const auto l = static_cast<std::size_t>(v);
+            if constexpr (isMatrix) {
+                return 2U * static_cast<std::size_t>(rows[l]) + static_cast<std::size_t>(columns[l]);
+            } else {
+                return static_cast<std::size_t>(rows[l]);
+            }
+        }
+
+        // fix (or release, if `value` is -1) the variables that determine the edge with index `index` at level `k`
+        void fix(dd::Qubit k, std::size_t index, std::int8_t value) {
+            const auto s = static_cast<std::size_t>(source[static_cast<std::size_t>(k)]);
+            const auto l = static_cast<std::size_t>(k);
+            if constexpr (isMatrix) {
+                const auto row    = value < 0 ? value : static_cast<std::int8_t>(index / 2U);
+                const auto column = value < 0 ? value : static_cast<std::int8_t>(index % 2U);
+                if (regular) {
+                    rows[s]    = row;
+                    columns[l] = column;
+                } else {
+                    rows[l]    = row;
+                    columns[s] = column;
+                }
+            } else {
+                rows[s] = value < 0 ? value : static_cast<std::int8_t>(index);
+            }
+        }
+
+        // follow the edge through all levels whose variables are fixed
+        Edge descend(Edge e) {
+            while (!e.w.approximatelyZero() && !e.isTerminal() && isFixed(e.p->v)) {
+                const auto& child = e.p->e[fixedIndex(e.p->v)];
+                if (child.w.approximatelyZero()) {
+                    return Edge::zero;
+                }
+                auto next = expand(child, static_cast<dd::Qubit>(e.p->v - 1));
+                next.w    = multiply(e.w, child.w);
+                e         = next;
+            }
+            return e;
+        }
+
+        // the part of the result at levels `k` and below for the given (descended) edge of the original decision diagram
+        Edge build(dd::Qubit k, const Edge& e) {
+            if (e.w.approximatelyZero()) {
+                return Edge::zero;
+            }
+            if (k < 0) {
+                // all variables are fixed and, hence, the edge points to the terminal
+                return e;
+            }
+            const auto r = rebuild(k, e.p);
+            return {r.p, multiply(e.w, r.w)};
+        }
+
+        Edge rebuild(dd::Qubit k, Node* p) {
+            // all levels above `p` are fixed. The result only depends on the values fixed at or below its level
+            const auto               v = static_cast<std::size_t>(p->v);
+            std::vector<std::int8_t> key{static_cast<std::int8_t>(k)};
+            key.insert(key.end(), rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(v + 1U));
+            if constexpr (isMatrix) {
+                key.insert(key.end(), columns.begin(), columns.begin() + static_cast<std::ptrdiff_t>(v + 1U));
+            }
+            auto& entries = computed[p];
+            if (const auto it = entries.find(key); it != entries.end()) {
+                return it->second;
+            }
+
+            std::array<Edge, NEDGE> edges{};
+            for (std::size_t i = 0U; i < NEDGE; ++i) {
+                fix(k, i, 0);
+                edges[i] = build(static_cast<dd::Qubit>(k - 1), descend({p, dd::Complex::one}));
+                fix(k, i, -1);
+            }
+
+            const auto result = dd->makeDDNode(k, edges);
+            entries.emplace(std::move(key), result);
+            return result;
+        }
+    };
+
+    // Change the permutation of the given decision diagram from `from` to `to` (in the same way as `dd::changePermutation`),
+    // but by moving the levels of the decision diagram in a single pass instead of multiplying it with SWAP matrices.
+    // `from` is updated accordingly.
+    template<class DDType, class DDPackage>
+    void changePermutation(DDType& on, qc::Permutation& from, const qc::Permutation& to, std::unique_ptr<DDPackage>& dd, bool regular = true) {
+        // the level of the decision diagram that the data at each level has to be moved to
+        const auto             nlevels = from.size();
+        std::vector<dd::Qubit> target(nlevels, static_cast<dd::Qubit>(-1));
+        std::vector<bool>      taken(nlevels, false);
+        for (const auto& [qubit, goal]: to) {
+            const auto it = from.find(qubit);
+            if (it == from.end()) {
+                throw std::runtime_error("Permutation mismatch: qubit " + std::to_string(qubit) + " is not contained in the permutation.");
+            }
+            target[static_cast<std::size_t>(it->second)] = goal;
+            taken[static_cast<std::size_t>(goal)]        = true;
+        }
+        // all remaining levels keep their relative order
+        std::size_t next = 0U;
+        for (auto& t: target) {
+            if (t < 0) {
+                while (taken[next]) {
+                    ++next;
+                }
+                t = static_cast<dd::Qubit>(next++);
+            }
+        }
+
+        for (auto& [qubit, l]: from) {
+            l = target[static_cast<std::size_t>(l)];
+        }
+
+        bool identity = true;
+        for (std::size_t l = 0U; l < nlevels; ++l) {
+            identity = identity && target[l] == static_cast<dd::Qubit>(l);
+        }
+        if (identity) {
+            return;
+        }
+
+        LevelPermutation<std::remove_pointer_t<decltype(on.p)>, DDPackage> permutation(dd, target, regular);
+
+        auto saved = on;
+        on         = permutation(on);
+        dd->incRef(on);
+        dd->decRef(saved);
+        dd->garbageCollect();
+    }
+} // namespace ec
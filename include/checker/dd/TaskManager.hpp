@@ -6,7 +6,17 @@
 #pragma once
 
 #include "QuantumComputation.hpp"
+#include "checker/dd/GateApplication.hpp"
+#include "checker/dd/LevelPermutation.hpp"
+#include "checker/dd/simulation/SharedComputeTable.hpp"
 #include "dd/Operations.hpp"
+#include "parameterized/SymbolicOperation.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace ec {
     enum Direction : bool { Left  = true,
@@ -23,16 +33,91 @@ namespace ec {
         DDType                        internalState{};
         ec::Direction                 direction = Left;
 
+        // number of operations that have been processed so far
+        std::size_t position = 0U;
+
+        // physical qubits whose output is garbage, sorted by the number of operations after which they are no longer acted upon
+        std::vector<std::pair<std::size_t, dd::Qubit>> idleGarbage{};
+        std::size_t                                    nextIdleGarbage = 0U;
+
+        void initializeIdleGarbage() {
+            const auto               nqubits = qc->getNqubits();
+            std::vector<std::size_t> lastUse(nqubits, 0U);
+            for (std::size_t i = 0U; i < qc->size(); ++i) {
+                const auto& op = qc->at(i);
+                if (op->isStandardOperation()) {
+                    for (const auto& target: op->getTargets()) {
+                        lastUse[static_cast<std::size_t>(target)] = i + 1U;
+                    }
+                    for (const auto& control: op->getControls()) {
+                        lastUse[static_cast<std::size_t>(control.qubit)] = i + 1U;
+                    }
+                } else {
+                    for (dd::QubitCount q = 0U; q < nqubits; ++q) {
+                        if (op->actsOn(static_cast<dd::Qubit>(q))) {
+                            lastUse[q] = i + 1U;
+                        }
+                    }
+                }
+            }
+            for (const auto& [physical, logical]: qc->outputPermutation) {
+                if (qc->logicalQubitIsGarbage(logical)) {
+                    idleGarbage.emplace_back(lastUse[static_cast<std::size_t>(physical)], physical);
+                }
+            }
+            std::sort(idleGarbage.begin(), idleGarbage.end());
+        }
+
+        // whether the circuit contains operations with symbolic parameters and whether any of them has been turned into a DD
+        bool parameterized              = false;
+        bool usedParameterizedOperation = false;
+
+        void trackParameterizedOperation() {
+            if (parameterized && !usedParameterizedOperation && SymbolicOperation::isSymbolic(**iterator)) {
+                usedParameterizedOperation = true;
+            }
+        }
+
+        // gate applications that are shared with the simulations of other checkers (only used for state vectors).
+        // Operations are identified by their position in the circuit and the given index of the circuit
+        SharedComputeTable::Client* sharedTable = nullptr;
+        std::uint64_t               circuitIndex{};
+        // sharing stops once the state has become too large (until the task is reset)
+        bool sharing = false;
+
     public:
         explicit TaskManager(const qc::QuantumComputation& qc, std::unique_ptr<DDPackage>& package, const ec::Direction& direction = Left) noexcept:
             qc(&qc), package(package), direction(direction) {
-            permutation = qc.initialLayout;
-            iterator    = qc.begin();
-            end         = qc.end();
+            permutation   = qc.initialLayout;
+            iterator      = qc.begin();
+            end           = qc.end();
+            parameterized = SymbolicOperation::isSymbolic(qc);
+            initializeIdleGarbage();
+        }
+
+        // restart the processing of the circuit from its beginning
+        void reset() noexcept {
+            permutation     = qc->initialLayout;
+            iterator        = qc->begin();
+            position        = 0U;
+            nextIdleGarbage = 0U;
+            sharing         = sharedTable != nullptr;
+        }
+
+        void setSharedTable(SharedComputeTable::Client* table, std::uint64_t circuit) noexcept {
+            sharedTable  = table;
+            circuitIndex = circuit;
+            sharing      = table != nullptr;
         }
 
         [[nodiscard]] bool finished() const noexcept { return iterator == end; }
 
+        // skip all remaining operations (e.g., since the final representation of the circuit is already known)
+        void skip() noexcept {
+            iterator = end;
+            position = qc->size();
+        }
+
         const std::unique_ptr<qc::Operation>& operator()() const { return *iterator; }
 
         [[nodiscard]] const DDType& getInternalState() const noexcept {
@@ -43,18 +128,66 @@ namespace ec {
         }
         void flipDirection() noexcept { direction = (direction == Left) ? Right : Left; }
 
-        [[nodiscard]] inline qc::MatrixDD getDD() { return dd::getDD((*iterator).get(), package, permutation); }
-        [[nodiscard]] inline qc::MatrixDD getInverseDD() { return dd::getInverseDD((*iterator).get(), package, permutation); }
+        [[nodiscard]] inline qc::MatrixDD getDD() {
+            trackParameterizedOperation();
+            return dd::getDD((*iterator).get(), package, permutation);
+        }
+        [[nodiscard]] inline qc::MatrixDD getInverseDD() {
+            trackParameterizedOperation();
+            return dd::getInverseDD((*iterator).get(), package, permutation);
+        }
+
+        // whether the result so far depends on the concrete instantiation of symbolic parameters
+        [[nodiscard]] bool usedParameterizedOperations() const noexcept { return usedParameterizedOperation; }
 
         [[nodiscard]] const qc::QuantumComputation* getCircuit() const noexcept { return qc; }
 
         [[nodiscard]] const qc::Permutation& getPermutation() const noexcept { return permutation; }
 
-        void advanceIterator() { ++iterator; }
+        void advanceIterator() {
+            ++iterator;
+            ++position;
+        }
+
+        // whether the current operation is an (uncontrolled) SWAP that merely relabels qubits
+        [[nodiscard]] bool isSwap() const {
+            return (*iterator)->getType() == qc::SWAP && !(*iterator)->isControlled();
+        }
+
+        // SWAP operations are not applied to the decision diagram. Instead, only the tracked permutation is updated,
+        // which is reconciled with the output permutation once at the end (see `changePermutation`)
+        void applySwap() {
+            const auto& targets = (*iterator)->getTargets();
+            std::swap(permutation.at(targets[0]), permutation.at(targets[1]));
+            advanceIterator();
+        }
 
         void applyGate(DDType& to) {
+            if (isSwap()) {
+                applySwap();
+                return;
+            }
+
             auto saved = to;
-            if constexpr (std::is_same_v<DDType, qc::VectorDD>) {
+
+            std::optional<SharedComputeTable::NodeID> node{};
+            const auto                                operation = (circuitIndex << 32U) | position;
+            if constexpr (std::is_same_v<DDType, qc::VectorDD> && std::is_same_v<DDPackage, SimulationDDPackage>) {
+                if (sharing) {
+                    node = sharedTable->identify(to);
+                    // states usually only grow along the circuit
+                    sharing = node.has_value();
+                }
+            }
+
+            if (const auto shared = lookupShared(operation, node, to)) {
+                to = *shared;
+                trackParameterizedOperation();
+                node.reset();
+            } else if (ec::applySingleTargetGate(to, **iterator, permutation, package, direction)) {
+                // single-target gates are directly applied to the affected levels
+                trackParameterizedOperation();
+            } else if constexpr (std::is_same_v<DDType, qc::VectorDD>) {
                 // direction has no effect on state vector DDs
                 to = package->multiply(getDD(), to);
             } else {
@@ -64,10 +197,24 @@ namespace ec {
                     to = package->multiply(to, getInverseDD());
                 }
             }
+            if constexpr (std::is_same_v<DDType, qc::VectorDD> && std::is_same_v<DDPackage, SimulationDDPackage>) {
+                if (node) {
+                    sharedTable->insert(operation, *node, saved, to);
+                }
+            }
             package->incRef(to);
             package->decRef(saved);
             package->garbageCollect();
-            ++iterator;
+            advanceIterator();
+        }
+
+        [[nodiscard]] std::optional<DDType> lookupShared([[maybe_unused]] std::uint64_t operation, [[maybe_unused]] const std::optional<SharedComputeTable::NodeID>& node, [[maybe_unused]] const DDType& state) {
+            if constexpr (std::is_same_v<DDType, qc::VectorDD> && std::is_same_v<DDPackage, SimulationDDPackage>) {
+                if (node) {
+                    return sharedTable->lookup(operation, *node, state);
+                }
+            }
+            return std::nullopt;
         }
 
         void applySwapOperations(DDType& state) {
@@ -82,6 +229,7 @@ namespace ec {
             for (std::size_t i = 0U; i < steps && !finished(); ++i) {
                 applyGate(state);
                 applySwapOperations(state);
+                reduceIdleGarbage(state);
             }
         }
         void advance(std::size_t steps = 1U) { advance(internalState, steps); }
@@ -94,7 +242,7 @@ namespace ec {
         void finish() { finish(internalState); }
 
         void changePermutation(DDType& state) {
-            dd::changePermutation(state, permutation, qc->outputPermutation, package, direction);
+            ec::changePermutation(state, permutation, qc->outputPermutation, package, direction);
         }
         void changePermutation() { changePermutation(internalState); }
 
@@ -114,6 +262,31 @@ namespace ec {
         }
         void reduceGarbage() { reduceGarbage(internalState); }
 
+        // sum up the contributions of all garbage qubits that are no longer acted upon by the remaining operations.
+        // since all remaining operations act trivially on these qubits, this commutes with the rest of the circuit and
+        // keeps the decision diagram small instead of carrying the full contribution of garbage qubits until the very end.
+        // for matrices, the reduction is applied to the output side of the circuit, i.e., it depends on the direction
+        void reduceIdleGarbage(DDType& state) {
+            if (nextIdleGarbage == idleGarbage.size() || idleGarbage[nextIdleGarbage].first > position) {
+                return;
+            }
+            std::vector<bool> garbage(qc->getNqubits(), false);
+            while (nextIdleGarbage < idleGarbage.size() && idleGarbage[nextIdleGarbage].first <= position) {
+                garbage[static_cast<std::size_t>(permutation.at(idleGarbage[nextIdleGarbage].second))] = true;
+                ++nextIdleGarbage;
+            }
+            auto saved = state;
+            if constexpr (std::is_same_v<DDType, qc::VectorDD>) {
+                state = package->reduceGarbage(state, garbage);
+            } else if constexpr (std::is_same_v<DDType, qc::MatrixDD>) {
+                state = package->reduceGarbage(state, garbage, direction);
+            }
+            package->incRef(state);
+            package->decRef(saved);
+            package->garbageCollect();
+        }
+        void reduceIdleGarbage() { reduceIdleGarbage(internalState); }
+
         void incRef(DDType& state) {
             package->incRef(state);
         }
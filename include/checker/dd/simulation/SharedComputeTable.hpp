@@ -0,0 +1,141 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "checker/dd/DDPackageConfigs.hpp"
+#include "dd/Package.hpp"
+#include "nlohmann/json.hpp"
+
+#include <array>
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ec {
+    // Lossy table of gate applications that is shared by all simulation checkers of a manager. All of them process the same
+    // pair of circuits, so that (especially near the top of the circuits, where the stimuli are still simple) they repeatedly
+    // apply the same operations to the same states, each in its own decision diagram package.
+    // Since nodes of different packages cannot be compared, states are identified via a shared unique table of their structure
+    // (with edge weights rounded to the numerical tolerance). The compute table maps an operation of either circuit and a state
+    // to the resulting state. Both tables have a fixed capacity and are lock-free: nodes that do not fit into the unique table
+    // are not shared and entries of the compute table are overwritten by newer ones.
+    class SharedComputeTable {
+    public:
+        using NodeID                     = std::uint64_t;
+        static constexpr NodeID TERMINAL = 0U;
+
+        struct Node {
+            dd::Qubit                            v{};
+            std::array<NodeID, 2U>               children{};
+            std::array<std::complex<dd::fp>, 2U> weights{};
+        };
+
+        // the state (i.e., a node and the weight of the edge pointing to it) resulting from an operation
+        struct Result {
+            NodeID               node = TERMINAL;
+            std::complex<dd::fp> weight{};
+        };
+
+        // the capacity of both tables is rounded up to a power of two
+        explicit SharedComputeTable(std::size_t capacity = 1U << 16U, dd::fp tolerance = dd::ComplexTable<>::tolerance());
+
+        // the ID of the node with the given structure or nothing if there is no room for it
+        [[nodiscard]] std::optional<NodeID> intern(const Node& node);
+        [[nodiscard]] const Node&           node(NodeID id) const;
+
+        // `operation` identifies an operation of either circuit and `client` the checker that looks up or provides the entry
+        [[nodiscard]] std::optional<Result> lookup(std::uint64_t operation, NodeID node, std::size_t client);
+        void                                insert(std::uint64_t operation, NodeID node, const Result& result, std::size_t client);
+
+        [[nodiscard]] std::size_t newClient() { return clients.fetch_add(1U, std::memory_order_relaxed) + 1U; }
+
+        [[nodiscard]] std::size_t getLookups() const { return lookups.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::size_t getHits() const { return hits.load(std::memory_order_relaxed); }
+        // hits on entries that have been provided by another checker (i.e., another thread in parallel checks)
+        [[nodiscard]] std::size_t getCrossHits() const { return crossHits.load(std::memory_order_relaxed); }
+        [[nodiscard]] nlohmann::json json() const;
+
+        // The view of a single checker (and its package) on the shared table. Nodes of the package that have been identified
+        // and nodes that have been reconstructed from the shared unique table are kept alive until `clear` is called.
+        class Client {
+        public:
+            Client(std::shared_ptr<SharedComputeTable> table, std::unique_ptr<SimulationDDPackage>& dd);
+
+            // the ID of the given state or nothing if it is too large to be shared
+            [[nodiscard]] std::optional<NodeID> identify(const qc::VectorDD& state);
+            // the state resulting from applying the operation to the given state (with the identified node), if known
+            [[nodiscard]] std::optional<qc::VectorDD> lookup(std::uint64_t operation, NodeID node, const qc::VectorDD& state);
+            void                                      insert(std::uint64_t operation, NodeID node, const qc::VectorDD& state, const qc::VectorDD& result);
+
+            // release all nodes that are kept alive for the shared table
+            void clear();
+
+        protected:
+            // the maximum number of nodes of a state that have not been identified before. Larger states are not shared
+            static constexpr std::size_t MAX_NEW_NODES = 256U;
+            // the maximum number of nodes that are kept alive before all of them are released
+            static constexpr std::size_t MAX_LOCAL_NODES = 1U << 16U;
+
+            std::shared_ptr<SharedComputeTable>  table;
+            std::unique_ptr<SimulationDDPackage>& dd;
+            std::size_t                           id;
+
+            std::unordered_map<dd::vNode*, NodeID>   ids{};
+            std::unordered_map<NodeID, qc::VectorDD> nodes{};
+
+            [[nodiscard]] std::optional<NodeID> identify(dd::vNode* p, std::size_t& budget);
+            [[nodiscard]] qc::VectorDD          materialize(NodeID node);
+        };
+
+    protected:
+        // the key of a node with all weights rounded to the tolerance
+        using Key = std::array<std::int64_t, 7U>;
+
+        enum class SlotState : std::uint8_t { Empty,
+                                              Writing,
+                                              Ready };
+
+        // a node is published by setting its state to `Ready` and is never modified afterwards
+        struct UniqueSlot {
+            std::atomic<SlotState> state{SlotState::Empty};
+            Key                    key{};
+            Node                   node{};
+        };
+
+        // entries are guarded by a sequence number that is odd while the entry is written (and zero before the first write)
+        struct ComputeSlot {
+            std::atomic<std::uint64_t> sequence{0U};
+            std::atomic<std::uint64_t> operation{};
+            std::atomic<NodeID>        node{};
+            std::atomic<NodeID>        result{};
+            std::atomic<dd::fp>        real{};
+            std::atomic<dd::fp>        imag{};
+            std::atomic<std::size_t>   client{};
+        };
+
+        // the number of slots of the unique table that are probed for a node
+        static constexpr std::size_t MAX_PROBES = 16U;
+
+        dd::fp                   tolerance;
+        std::size_t              mask;
+        std::vector<UniqueSlot>  uniqueTable;
+        std::vector<ComputeSlot> computeTable;
+
+        std::atomic<std::size_t> clients{0U};
+        std::atomic<std::size_t> lookups{0U};
+        std::atomic<std::size_t> hits{0U};
+        std::atomic<std::size_t> crossHits{0U};
+
+        [[nodiscard]] Key                key(const Node& node) const;
+        [[nodiscard]] static std::size_t hash(const Key& key);
+    };
+} // namespace ec
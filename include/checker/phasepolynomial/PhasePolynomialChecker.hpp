@@ -0,0 +1,79 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "checker/EquivalenceChecker.hpp"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace ec {
+    // Checker for circuits exclusively consisting of X, CNOT, SWAP, and (singly-controlled) diagonal phase gates.
+    // Such a circuit maps each basis state |x> to exp(i*f(x))|Ax+b>, where Ax+b is an affine function over GF(2) and
+    // the phase polynomial f is a weighted sum of parities of the inputs. Both circuits are equivalent if and only if
+    // their affine parts coincide and the difference of their phase polynomials is constant (modulo 2*pi) for all inputs.
+    // Both conditions are decided in polynomial time (for dyadic angles such as multiples of pi/4) without ever
+    // constructing a decision diagram.
+    class PhasePolynomialChecker: public EquivalenceChecker {
+    public:
+        PhasePolynomialChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration);
+
+        // whether the circuit only consists of X, CNOT, SWAP, and (singly-controlled) Z, S, T, Phase, and RZ gates
+        [[nodiscard]] static bool isApplicable(const qc::QuantumComputation& qc);
+
+        EquivalenceCriterion run() override;
+
+        void json(nlohmann::json& j) const noexcept override {
+            EquivalenceChecker::json(j);
+            j["checker"]      = "phase_polynomial";
+            j["parity_terms"] = parityTerms;
+        }
+
+    protected:
+        // the rows of the linear part are stored as bit-packed vectors over the primary inputs
+        using Word      = std::uint64_t;
+        using BitVector = std::vector<Word>;
+
+        // an affine function a.x + b over GF(2)
+        struct Affine {
+            BitVector bits{};
+            bool      constant = false;
+        };
+
+        struct PhasePolynomial {
+            // the function computed at each physical qubit
+            std::vector<Affine> wires{};
+            // the accumulated angle of each (non-zero) parity of the inputs
+            std::map<BitVector, dd::fp> terms{};
+            dd::fp                      globalPhase = 0.;
+        };
+
+        // the physical qubit holding each logical input and output (or -1 if there is none)
+        std::vector<std::ptrdiff_t> inputs1{};
+        std::vector<std::ptrdiff_t> inputs2{};
+        std::vector<std::ptrdiff_t> outputs1{};
+        std::vector<std::ptrdiff_t> outputs2{};
+
+        // logical qubits that are variables of the phase polynomials (all others are ancillaries initialized to |0>)
+        std::size_t ninputs{};
+        // whether some outputs are garbage or missing. Then, the check is inconclusive
+        bool partial = false;
+
+        std::size_t parityTerms = 0U;
+
+        // the candidate subsets of inputs that are examined per order before giving up
+        static constexpr std::size_t MAX_CANDIDATES = 1U << 20U;
+
+        [[nodiscard]] PhasePolynomial compute(const qc::QuantumComputation& qc, const std::vector<std::ptrdiff_t>& inputs) const;
+
+        // whether the difference of both phase polynomials is constant modulo 2*pi
+        EquivalenceCriterion comparePhases(const std::map<BitVector, dd::fp>& difference);
+
+        [[nodiscard]] bool isMultiple(dd::fp angle, dd::fp modulus) const;
+    };
+} // namespace ec
@@ -0,0 +1,91 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "checker/EquivalenceChecker.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ec {
+    // Checker for classical reversible circuits, i.e., circuits exclusively consisting of (multi-)controlled X and SWAP gates.
+    // Such circuits permute the computational basis states. Hence, two of them are equivalent if and only if they produce the
+    // same output for every basis state, i.e., if they realize the same truth table.
+    // The circuits are simulated bit-parallel (bitsliced): each qubit is represented by a block of machine words whose bits
+    // correspond to different input assignments, so that each gate is evaluated for 256 inputs using a few bitwise operations.
+    // Up to `reversible.maxExhaustiveInputs` inputs, all input assignments are checked and the result is exact.
+    // Otherwise, `reversible.nRandomStimuli` random input assignments are checked.
+    class ReversibleChecker: public EquivalenceChecker {
+    public:
+        ReversibleChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration);
+
+        // whether the circuit only consists of (multi-)controlled X and SWAP gates
+        [[nodiscard]] static bool isReversible(const qc::QuantumComputation& qc);
+
+        EquivalenceCriterion run() override;
+
+        // the input assignment (over all logical qubits, the highest qubit first) that produced different outputs
+        [[nodiscard]] const std::string& getCounterexample() const noexcept { return counterexample; }
+
+        void json(nlohmann::json& j) const noexcept override {
+            EquivalenceChecker::json(j);
+            j["checker"]         = "reversible";
+            j["exhaustive"]      = exhaustive;
+            j["checked_stimuli"] = checkedStimuli;
+            if (!counterexample.empty()) {
+                j["counterexample"] = counterexample;
+            }
+        }
+
+    protected:
+        // each block holds the values of a qubit for WIDTH different input assignments
+        static constexpr std::size_t LANES = 4U;
+        static constexpr std::size_t WIDTH = LANES * 64U;
+        using Word                         = std::uint64_t;
+        using Block                        = std::array<Word, LANES>;
+
+        // a (multi-)controlled X (if `target1` is negative) or SWAP gate acting on physical qubits
+        struct Gate {
+            std::vector<std::pair<std::size_t, bool>> controls{};
+            std::size_t                               target0{};
+            std::ptrdiff_t                            target1 = -1;
+        };
+
+        struct Circuit {
+            std::size_t       nqubits{};
+            std::vector<Gate> gates{};
+            // the physical qubit holding each logical input and output (or -1 if there is none)
+            std::vector<std::ptrdiff_t> inputs{};
+            std::vector<std::ptrdiff_t> outputs{};
+        };
+
+        Circuit circuit1;
+        Circuit circuit2;
+
+        // logical qubits that are set by the stimuli (all others are ancillaries initialized to |0>)
+        std::size_t ninputs{};
+        // logical outputs that are compared (i.e., that are neither garbage nor missing in one of the circuits)
+        std::vector<std::size_t> compared{};
+        // whether some outputs are not compared. Then, matching truth tables do not prove the equivalence
+        bool partial = false;
+
+        bool        exhaustive     = false;
+        std::size_t checkedStimuli = 0U;
+        std::string counterexample{};
+
+        [[nodiscard]] Circuit compile(const qc::QuantumComputation& qc) const;
+        static void           simulate(const Circuit& circuit, const std::vector<Block>& inputs, std::vector<Block>& state);
+
+        // the input block of logical qubit `input` for the given block of exhaustive enumeration
+        [[nodiscard]] static Block exhaustiveInput(std::size_t input, std::size_t block);
+
+        // compare the outputs of both circuits for a single block of inputs and record a counterexample if they differ
+        bool compare(const std::vector<Block>& inputs, std::vector<Block>& state1, std::vector<Block>& state2);
+    };
+} // namespace ec
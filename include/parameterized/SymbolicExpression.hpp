@@ -0,0 +1,116 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "dd/Package.hpp"
+
+#include <cmath>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+
+namespace ec {
+    // assignment of values to the variables of a symbolic expression
+    using VariableAssignment = std::map<std::string, dd::fp>;
+
+    // A linear expression c + a_1 * x_1 + ... + a_n * x_n over real-valued variables x_i.
+    // Linear expressions suffice to describe the rotation angles emitted by typical variational compilers and
+    // are closed under the operations needed to merge and cancel rotations (addition, negation, scaling).
+    class SymbolicExpression {
+    public:
+        SymbolicExpression() = default;
+        SymbolicExpression(dd::fp constant): // NOLINT(google-explicit-constructor)
+            constant(constant) {}
+        explicit SymbolicExpression(const std::string& variable, dd::fp coefficient = 1.):
+            terms({{variable, coefficient}}) {
+            prune();
+        }
+
+        [[nodiscard]] bool                                 isConstant() const noexcept { return terms.empty(); }
+        [[nodiscard]] dd::fp                               getConstant() const noexcept { return constant; }
+        [[nodiscard]] const std::map<std::string, dd::fp>& getTerms() const noexcept { return terms; }
+
+        [[nodiscard]] std::set<std::string> getVariables() const {
+            std::set<std::string> variables{};
+            for (const auto& [variable, coefficient]: terms) {
+                variables.emplace(variable);
+            }
+            return variables;
+        }
+
+        [[nodiscard]] dd::fp evaluate(const VariableAssignment& assignment) const {
+            auto value = constant;
+            for (const auto& [variable, coefficient]: terms) {
+                const auto it = assignment.find(variable);
+                if (it == assignment.end()) {
+                    throw std::runtime_error("No value assigned to variable: " + variable);
+                }
+                value += coefficient * it->second;
+            }
+            return value;
+        }
+
+        SymbolicExpression& operator+=(const SymbolicExpression& rhs) {
+            constant += rhs.constant;
+            for (const auto& [variable, coefficient]: rhs.terms) {
+                terms[variable] += coefficient;
+            }
+            prune();
+            return *this;
+        }
+        SymbolicExpression& operator-=(const SymbolicExpression& rhs) {
+            return *this += -rhs;
+        }
+        SymbolicExpression& operator*=(dd::fp factor) {
+            constant *= factor;
+            for (auto& [variable, coefficient]: terms) {
+                coefficient *= factor;
+            }
+            prune();
+            return *this;
+        }
+
+        friend SymbolicExpression operator-(SymbolicExpression expr) { return expr *= -1.; }
+        friend SymbolicExpression operator+(SymbolicExpression lhs, const SymbolicExpression& rhs) { return lhs += rhs; }
+        friend SymbolicExpression operator-(SymbolicExpression lhs, const SymbolicExpression& rhs) { return lhs -= rhs; }
+        friend SymbolicExpression operator*(SymbolicExpression lhs, dd::fp factor) { return lhs *= factor; }
+        friend SymbolicExpression operator*(dd::fp factor, SymbolicExpression rhs) { return rhs *= factor; }
+        friend SymbolicExpression operator/(SymbolicExpression lhs, dd::fp divisor) { return lhs *= (1. / divisor); }
+
+        // two expressions are considered equal if their difference vanishes (up to the numerical tolerance)
+        friend bool operator==(const SymbolicExpression& lhs, const SymbolicExpression& rhs) {
+            const auto difference = lhs - rhs;
+            return difference.isConstant() && std::abs(difference.getConstant()) < dd::ComplexTable<>::tolerance();
+        }
+        friend bool operator!=(const SymbolicExpression& lhs, const SymbolicExpression& rhs) { return !(lhs == rhs); }
+
+        [[nodiscard]] std::string toString() const {
+            std::stringstream ss{};
+            ss << constant;
+            for (const auto& [variable, coefficient]: terms) {
+                ss << (coefficient < 0. ? " - " : " + ") << std::abs(coefficient) << "*" << variable;
+            }
+            return ss.str();
+        }
+        friend std::ostream& operator<<(std::ostream& os, const SymbolicExpression& expr) { return os << expr.toString(); }
+
+    protected:
+        std::map<std::string, dd::fp> terms{};
+        dd::fp                        constant{};
+
+        // remove all terms whose coefficient has been cancelled
+        void prune() {
+            for (auto it = terms.begin(); it != terms.end();) {
+                if (std::abs(it->second) < dd::ComplexTable<>::tolerance()) {
+                    it = terms.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    };
+} // namespace ec
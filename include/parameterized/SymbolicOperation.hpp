@@ -0,0 +1,169 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#pragma once
+
+#include "QuantumComputation.hpp"
+#include "SymbolicExpression.hpp"
+#include "operations/StandardOperation.hpp"
+
+#include <set>
+#include <string>
+
+namespace ec {
+    // A (controlled) rotation gate whose angle is given by a symbolic expression.
+    // The numeric parameter of the underlying standard operation always holds the angle for the most recent
+    // instantiation, so that the operation can be handled by the decision diagram package like any other gate.
+    class SymbolicOperation final: public qc::StandardOperation {
+    public:
+        SymbolicOperation(dd::QubitCount nq, const dd::Controls& controls, dd::Qubit target, qc::OpType g, const SymbolicExpression& angle, dd::Qubit startingQubit = 0):
+            qc::StandardOperation(nq, controls, target, g, angle.getConstant(), 0., 0., startingQubit),
+            angle(angle) {
+            if (!isSupported(g)) {
+                throw std::invalid_argument("Symbolic parameters are only supported for RX, RY, RZ, and Phase gates.");
+            }
+            // the standard operation turns phase gates with special angles (e.g., 0 or pi) into fixed gates (e.g., I or Z).
+            // Since the angle of a symbolic operation changes with every instantiation, the original gate is restored
+            setGate(g);
+            parameter[0] = angle.getConstant();
+        }
+        SymbolicOperation(dd::QubitCount nq, dd::Qubit target, qc::OpType g, const SymbolicExpression& angle, dd::Qubit startingQubit = 0):
+            SymbolicOperation(nq, dd::Controls{}, target, g, angle, startingQubit) {}
+
+        [[nodiscard]] std::unique_ptr<qc::Operation> clone() const override {
+            return std::make_unique<SymbolicOperation>(*this);
+        }
+
+        [[nodiscard]] const SymbolicExpression& getAngle() const noexcept { return angle; }
+
+        // set the numeric parameter according to the given assignment
+        void instantiate(const VariableAssignment& assignment) {
+            parameter[0] = angle.evaluate(assignment);
+        }
+
+        using qc::StandardOperation::equals;
+        [[nodiscard]] bool equals(const qc::Operation& op, const qc::Permutation& perm1, const qc::Permutation& perm2) const override {
+            // symbolic operations are only equal if their angle expressions (and not just their current instantiations) match
+            if (const auto* other = dynamic_cast<const SymbolicOperation*>(&op)) {
+                if (angle != other->angle) {
+                    return false;
+                }
+            } else if (!angle.isConstant()) {
+                return false;
+            }
+            return qc::StandardOperation::equals(op, perm1, perm2);
+        }
+
+        [[nodiscard]] static bool isSupported(qc::OpType g) noexcept {
+            return g == qc::RX || g == qc::RY || g == qc::RZ || g == qc::Phase;
+        }
+
+        // whether the operation depends on any variable
+        [[nodiscard]] static bool isSymbolic(const qc::Operation& op) {
+            if (const auto* symbolic = dynamic_cast<const SymbolicOperation*>(&op)) {
+                return !symbolic->angle.isConstant();
+            }
+            if (const auto* compound = dynamic_cast<const qc::CompoundOperation*>(&op)) {
+                for (const auto& o: *compound) {
+                    if (isSymbolic(*o)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] static bool isSymbolic(const qc::QuantumComputation& qc) {
+            for (const auto& op: qc) {
+                if (isSymbolic(*op)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static void collectVariables(const qc::Operation& op, std::set<std::string>& variables) {
+            if (const auto* symbolic = dynamic_cast<const SymbolicOperation*>(&op)) {
+                const auto vars = symbolic->angle.getVariables();
+                variables.insert(vars.begin(), vars.end());
+            } else if (const auto* compound = dynamic_cast<const qc::CompoundOperation*>(&op)) {
+                for (const auto& o: *compound) {
+                    collectVariables(*o, variables);
+                }
+            }
+        }
+
+        [[nodiscard]] static std::set<std::string> getVariables(const qc::QuantumComputation& qc) {
+            std::set<std::string> variables{};
+            for (const auto& op: qc) {
+                collectVariables(*op, variables);
+            }
+            return variables;
+        }
+
+        // instantiate all symbolic operations of a circuit with the given assignment
+        static void instantiate(qc::Operation& op, const VariableAssignment& assignment) {
+            if (auto* symbolic = dynamic_cast<SymbolicOperation*>(&op)) {
+                symbolic->instantiate(assignment);
+            } else if (auto* compound = dynamic_cast<qc::CompoundOperation*>(&op)) {
+                for (auto& o: *compound) {
+                    instantiate(*o, assignment);
+                }
+            }
+        }
+
+        static void instantiate(qc::QuantumComputation& qc, const VariableAssignment& assignment) {
+            for (auto& op: qc) {
+                instantiate(*op, assignment);
+            }
+        }
+
+        // Merge consecutive rotations around the same axis acting on the same qubits, e.g., RZ(a) RZ(b) -> RZ(a+b),
+        // by adding up their angle expressions. This allows identical expressions to emerge (and subsequently cancel)
+        // even if one of the circuits splits or combines rotations.
+        // Whenever the variables cancel entirely, the merged operation no longer depends on any variable.
+        static void mergeRotations(qc::QuantumComputation& qc) {
+            std::size_t i = 0U;
+            while (i + 1U < qc.size()) {
+                auto& first  = qc.at(i);
+                auto& second = qc.at(i + 1U);
+
+                auto* firstSymbolic  = dynamic_cast<SymbolicOperation*>(first.get());
+                auto* secondSymbolic = dynamic_cast<SymbolicOperation*>(second.get());
+                if ((firstSymbolic == nullptr && secondSymbolic == nullptr) || !areMergeable(*first, *second)) {
+                    ++i;
+                    continue;
+                }
+
+                // accumulate both rotations in the symbolic operation and remove the other one
+                if (firstSymbolic != nullptr) {
+                    firstSymbolic->absorb(*second);
+                    qc.erase(qc.begin() + static_cast<std::ptrdiff_t>(i + 1U));
+                } else {
+                    secondSymbolic->absorb(*first);
+                    qc.erase(qc.begin() + static_cast<std::ptrdiff_t>(i));
+                }
+            }
+        }
+
+    protected:
+        SymbolicExpression angle{};
+
+        [[nodiscard]] static bool areMergeable(const qc::Operation& op1, const qc::Operation& op2) {
+            return op1.isStandardOperation() && op2.isStandardOperation() &&
+                   op1.getType() == op2.getType() && isSupported(op1.getType()) &&
+                   op1.getTargets() == op2.getTargets() && op1.getControls() == op2.getControls();
+        }
+
+        void absorb(const qc::Operation& op) {
+            if (const auto* symbolic = dynamic_cast<const SymbolicOperation*>(&op)) {
+                angle += symbolic->angle;
+            } else {
+                angle += op.getParameter()[0];
+            }
+            parameter[0] += op.getParameter()[0];
+        }
+    };
+} // namespace ec
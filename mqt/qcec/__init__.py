@@ -3,6 +3,6 @@
 # See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
 #
 
-from mqt.qcec.pyqcec import ApplicationScheme, StateType, EquivalenceCriterion, EquivalenceCheckingManager, Configuration
+from mqt.qcec.pyqcec import ApplicationScheme, StateType, EquivalenceCriterion, EquivalenceCheckingManager, Configuration, OriginalCache
 
-__all__ = ["ApplicationScheme", "StateType", "EquivalenceCriterion", "EquivalenceCheckingManager", "Configuration"]
+__all__ = ["ApplicationScheme", "StateType", "EquivalenceCriterion", "EquivalenceCheckingManager", "Configuration", "OriginalCache"]
@@ -4,6 +4,7 @@
  */
 
 #include "EquivalenceCheckingManager.hpp"
+#include "parameterized/SymbolicOperation.hpp"
 #include "pybind11/chrono.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
@@ -11,14 +12,77 @@
 #include "qiskit/QasmQobjExperiment.hpp"
 #include "qiskit/QuantumCircuit.hpp"
 
+#include <cmath>
 #include <exception>
 #include <memory>
+#include <vector>
 
 namespace py = pybind11;
 namespace nl = nlohmann;
 using namespace pybind11::literals;
 
 namespace ec {
+    // convert a (linear) qiskit ParameterExpression into a symbolic expression
+    SymbolicExpression importExpression(const py::object& expr) {
+        py::dict zero{};
+        for (const auto& parameter: expr.attr("parameters")) {
+            zero[parameter] = 0.;
+        }
+        SymbolicExpression result(expr.attr("bind")(zero).cast<dd::fp>());
+        for (const auto& parameter: expr.attr("parameters")) {
+            const auto gradient = expr.attr("gradient")(parameter);
+            if (py::hasattr(gradient, "parameters") && py::len(gradient.attr("parameters")) > 0U) {
+                throw std::runtime_error("Only linear parameter expressions are supported, but got " + py::str(expr).cast<std::string>());
+            }
+            result += SymbolicExpression(py::str(parameter.attr("name")).cast<std::string>(), gradient.cast<dd::fp>());
+        }
+        return result;
+    }
+
+    // Circuits with unbound parameters are imported by binding every parameterized gate to a unique placeholder angle, importing
+    // the resulting circuit as usual, and replacing the operations carrying a placeholder by symbolic operations.
+    // Only (controlled) RX, RY, RZ, and Phase gates may be parameterized.
+    void importSymbolicCircuit(qc::QuantumComputation& qc, const py::object& circ) {
+        const py::object ParameterExpression = py::module::import("qiskit.circuit").attr("ParameterExpression");
+        constexpr dd::fp placeholderOffset   = 1e6;
+
+        auto                            bound = circ.attr("copy")();
+        std::vector<SymbolicExpression> expressions{};
+        for (const auto& instruction: bound.attr("data")) {
+            const auto operation = py::reinterpret_borrow<py::tuple>(instruction)[0];
+            auto       params    = py::list(operation.attr("params"));
+            for (std::size_t i = 0U; i < params.size(); ++i) {
+                if (py::isinstance(params[i], ParameterExpression) && py::len(params[i].attr("parameters")) > 0U) {
+                    if (params.size() != 1U) {
+                        throw std::runtime_error("Symbolic parameters are only supported for RX, RY, RZ, and Phase gates, but got " + py::str(operation.attr("name")).cast<std::string>());
+                    }
+                    expressions.emplace_back(importExpression(params[i]));
+                    params[i] = placeholderOffset + static_cast<dd::fp>(expressions.size() - 1U);
+                }
+            }
+            operation.attr("params") = params;
+        }
+
+        qc::qiskit::QuantumCircuit::import(qc, bound);
+
+        std::size_t replaced = 0U;
+        for (auto& op: qc) {
+            if (!op->isStandardOperation()) {
+                continue;
+            }
+            const auto index = op->getParameter().at(0) - placeholderOffset;
+            if (index < 0. || index >= static_cast<dd::fp>(expressions.size()) || index != std::floor(index)) {
+                continue;
+            }
+            const auto& expression = expressions.at(static_cast<std::size_t>(index));
+            op                     = std::make_unique<SymbolicOperation>(op->getNqubits(), op->getControls(), op->getTargets().at(0), op->getType(), expression, op->getStartingQubit());
+            ++replaced;
+        }
+        if (replaced != expressions.size()) {
+            throw std::runtime_error("Could not import all parameterized gates of the circuit.");
+        }
+    }
+
     qc::QuantumComputation importCircuit(const py::object& circ) {
         py::object QuantumCircuit       = py::module::import("qiskit").attr("QuantumCircuit");
         py::object pyQasmQobjExperiment = py::module::import("qiskit.qobj").attr("QasmQobjExperiment");
@@ -29,7 +93,11 @@ namespace ec {
             auto&& file = circ.cast<std::string>();
             qc.import(file);
         } else if (py::isinstance(circ, QuantumCircuit)) {
-            qc::qiskit::QuantumCircuit::import(qc, circ);
+            if (py::len(circ.attr("parameters")) > 0U) {
+                importSymbolicCircuit(qc, circ);
+            } else {
+                qc::qiskit::QuantumCircuit::import(qc, circ);
+            }
         } else if (py::isinstance(circ, pyQasmQobjExperiment)) {
             qc::qiskit::QasmQobjExperiment::import(qc, circ);
         } else {
@@ -66,13 +134,13 @@ namespace ec {
 
     std::unique_ptr<EquivalenceCheckingManager> createManagerFromOptions(const py::object& circ1, const py::object& circ2,
                                                                          // Execution
-                                                                         dd::fp               numericalTolerance     = dd::ComplexTable<>::tolerance(),
-                                                                         bool                 parallel               = true,
-                                                                         std::size_t          nthreads               = std::max(2U, std::thread::hardware_concurrency()),
-                                                                         std::chrono::seconds timeout                = 0s,
-                                                                         bool                 runConstructionChecker = false,
-                                                                         bool                 runSimulationChecker   = true,
-                                                                         bool                 runAlternatingChecker  = true,
+                                                                         dd::fp                    numericalTolerance     = dd::ComplexTable<>::tolerance(),
+                                                                         bool                      parallel               = true,
+                                                                         std::size_t               nthreads               = std::max<std::size_t>(2U, Resources::get().threads()),
+                                                                         std::chrono::milliseconds timeout                = 0ms,
+                                                                         bool                      runConstructionChecker = false,
+                                                                         bool                      runSimulationChecker   = true,
+                                                                         bool                      runAlternatingChecker  = true,
                                                                          // Optimization
                                                                          bool fixOutputPermutationMismatch     = false,
                                                                          bool fuseSingleQubitGates             = true,
@@ -89,7 +157,7 @@ namespace ec {
                                                                          double traceThreshold = 1e-8,
                                                                          // Simulation
                                                                          double           fidelityThreshold = 1e-8,
-                                                                         std::size_t      maxSims           = std::max(16U, std::thread::hardware_concurrency() - 2U),
+                                                                         std::size_t      maxSims           = std::max<std::size_t>(16U, Resources::get().threads(2U)),
                                                                          const StateType& stateType         = StateType::ComputationalBasis,
                                                                          std::size_t      seed              = 0U,
                                                                          bool             storeCEXinput     = false,
@@ -189,12 +257,18 @@ namespace ec {
 
         py::class_<Configuration> configuration(m, "Configuration", "Configuration options for the QCEC quantum circuit equivalence checking tool");
 
+        py::class_<OriginalCache, std::shared_ptr<OriginalCache>>(m, "OriginalCache", "Cache for the results of an original circuit that is checked against many compiled circuits. Share it between managers via :meth:`~.EquivalenceCheckingManager.set_original_cache`.")
+                .def(py::init<>())
+                .def_property_readonly("hits", &OriginalCache::getHits, "Number of representations of the original circuit that have been reused.")
+                .def_property_readonly("misses", &OriginalCache::getMisses, "Number of representations of the original circuit that had to be computed.")
+                .def("clear", &OriginalCache::clear, "Remove all cached representations.");
+
         // Constructors
         ecm.def(py::init(&createManagerFromOptions), "circ1"_a, "circ2"_a,
                 "numerical_tolerance"_a                  = dd::ComplexTable<>::tolerance(),
                 "parallel"_a                             = true,
-                "nthreads"_a                             = std::max(2U, std::thread::hardware_concurrency()),
-                "timeout"_a                              = 0s,
+                "nthreads"_a                             = std::max<std::size_t>(2U, Resources::get().threads()),
+                "timeout"_a                              = 0ms,
                 "run_construction_checker"_a             = false,
                 "run_simulation_checker"_a               = true,
                 "run_alternating_checker"_a              = true,
@@ -210,7 +284,7 @@ namespace ec {
                 "profile"_a                              = "",
                 "trace_threshold"_a                      = 1e-8,
                 "fidelity_threshold"_a                   = 1e-8,
-                "max_sims"_a                             = std::max(16U, std::thread::hardware_concurrency() - 2U),
+                "max_sims"_a                             = std::max<std::size_t>(16U, Resources::get().threads(2U)),
                 "state_type"_a                           = "computational_basis",
                 "seed"_a                                 = 0U,
                 "store_cex_input"_a                      = false,
@@ -220,6 +294,8 @@ namespace ec {
                      }),
                      "circ1"_a, "circ2"_a, "config"_a)
                 .def("get_configuration", &EquivalenceCheckingManager::getConfiguration)
+                .def("set_original_cache", &EquivalenceCheckingManager::setOriginalCache, "cache"_a,
+                     "Reuse the output states and the functionality of the original circuit (the first circuit) that have been computed by other managers sharing the same :class:`.OriginalCache`. Simulations only make use of the cache if a fixed :attr:`seed <.Configuration.Simulation.seed>` is set.")
 
                 // Convenience functions
                 // Execution
@@ -227,16 +303,24 @@ namespace ec {
                      "Set the :attr:`numerical tolerance <.Configuration.Execution.numerical_tolerance>` of the underlying decision diagram package.")
                 .def("set_parallel", &EquivalenceCheckingManager::setParallel, "enable"_a = true,
                      "Set whether execution should happen in :attr:`~Configuration.Execution.parallel`.")
-                .def("set_nthreads", &EquivalenceCheckingManager::setNThreads, "nthreads"_a = std::max(2U, std::thread::hardware_concurrency()),
+                .def("set_nthreads", &EquivalenceCheckingManager::setNThreads, "nthreads"_a = std::max<std::size_t>(2U, Resources::get().threads()),
                      "Set the maximum number of :attr:`threads <.Configuration.Execution.nthreads>` to use.")
                 .def("set_timeout", &EquivalenceCheckingManager::setTimeout, "timeout"_a = 0.0,
-                     "Set a :attr:`timeout <.Configuration.Execution.timeout>` (in seconds) for :func:`~EquivalenceCheckingManager.run`. The timeout can also be specified by a :class:`float`.")
+                     "Set a :attr:`timeout <.Configuration.Execution.timeout>` (in seconds) for :func:`~EquivalenceCheckingManager.run`. The timeout can also be specified by a :class:`float`, e.g., :code:`0.25` for 250 milliseconds.")
                 .def("set_construction_checker", &EquivalenceCheckingManager::setConstructionChecker, "enable"_a = false,
                      "Set whether the :attr:`construction checker <.Configuration.Execution.run_construction_checker>` should be executed.")
                 .def("set_simulation_checker", &EquivalenceCheckingManager::setSimulationChecker, "enable"_a = true,
                      "Set whether the :attr:`simulation checker <.Configuration.Execution.run_simulation_checker>` should be executed.")
                 .def("set_alternating_checker", &EquivalenceCheckingManager::setAlternatingChecker, "enable"_a = true,
                      "Set whether the :attr:`alternating checker <.Configuration.Execution.run_alternating_checker>` should be executed.")
+                .def("set_dynamic_circuit_checker", &EquivalenceCheckingManager::setDynamicCircuitChecker, "enable"_a = false,
+                     "Set whether the :attr:`dynamic circuit checker <.Configuration.Execution.run_dynamic_circuit_checker>` should be used for dynamic circuits.")
+                .def("set_reversible_checker", &EquivalenceCheckingManager::setReversibleChecker, "enable"_a = true,
+                     "Set whether the :attr:`reversible checker <.Configuration.Execution.run_reversible_checker>` should be used for classical reversible circuits.")
+                .def("set_n_instantiations", &EquivalenceCheckingManager::setNInstantiations, "instantiations"_a = 8U,
+                     "Set the number of random instantiations of the parameters that are checked if the equivalence of parameterized circuits cannot be shown symbolically.")
+                .def("set_phase_polynomial_checker", &EquivalenceCheckingManager::setPhasePolynomialChecker, "enable"_a = true,
+                     "Set whether the :attr:`phase polynomial checker <.Configuration.Execution.run_phase_polynomial_checker>` should be used for circuits consisting of CNOT and phase gates.")
                 // Optimization
                 .def("fix_output_permutation_mismatch", &EquivalenceCheckingManager::runFixOutputPermutationMismatch,
                      "Try to :attr:`fix potential mismatches in output permutations <.Configuration.Optimizations.fix_output_permutation_mismatch>`. This is experimental.")
@@ -269,7 +353,7 @@ namespace ec {
                 // Simulation
                 .def("set_fidelity_threshold", &EquivalenceCheckingManager::setFidelityThreshold, "threshold"_a = 1e-8,
                      "Set the :attr:`fidelity threshold <.Configuration.Simulation.fidelity_threshold>` used for comparing two states or state vectors.")
-                .def("set_max_sims", &EquivalenceCheckingManager::setMaxSims, "sims"_a = std::max(16U, std::thread::hardware_concurrency() - 2U),
+                .def("set_max_sims", &EquivalenceCheckingManager::setMaxSims, "sims"_a = std::max<std::size_t>(16U, Resources::get().threads(2U)),
                      "Set the :attr:`maximum number of simulations <.Configuration.Simulation.max_sims>` to be started for the simulation checker.")
                 .def("set_state_type", &EquivalenceCheckingManager::setStateType, "type"_a = "computational_basis",
                      "Set the :attr:`type of states <.Configuration.Simulation.state_type>` used for the simulations in the simulation checker.")
@@ -311,6 +395,10 @@ namespace ec {
                                "State vector representation of the first circuit's counterexample output state.")
                 .def_readwrite("cex_output2", &EquivalenceCheckingManager::Results::cexOutput2,
                                "State vector representation of the second circuit's counterexample output state.")
+                .def_readwrite("performed_instantiations", &EquivalenceCheckingManager::Results::performedInstantiations,
+                               "Number of parameter instantiations that have been checked for parameterized circuits.")
+                .def_readwrite("exhausted_budgets", &EquivalenceCheckingManager::Results::exhaustedBudgets,
+                               "Time budgets that ran out during the check (:code:`simulation`, :code:`alternating`, :code:`construction`, or :code:`total` for the timeout).")
                 .def("considered_equivalent", &EquivalenceCheckingManager::Results::consideredEquivalent,
                      "Convenience function to check whether the obtained result is to be considered equivalent.")
                 .def("json", &EquivalenceCheckingManager::Results::json,
@@ -323,6 +411,9 @@ namespace ec {
         py::class_<Configuration::Application>   application(configuration, "Application", "Options that describe the :class:`Application Scheme <.ApplicationScheme>` that is used for the individual equivalence checkers.");
         py::class_<Configuration::Functionality> functionality(configuration, "Functionality", "Options for all checkers that consider the whole functionality of a circuit.");
         py::class_<Configuration::Simulation>    simulation(configuration, "Simulation", "Options that influence the simulation-based equivalence checker.");
+        py::class_<Configuration::Reversible>    reversible(configuration, "Reversible", "Options that influence the checker for classical reversible circuits.");
+        py::class_<Configuration::Parameterized> parameterized(configuration, "Parameterized", "Options for checking circuits with symbolic parameters.");
+        py::class_<Configuration::PartialEquivalence> partialEquivalence(configuration, "PartialEquivalence", "Options for checking the equivalence with respect to a subset of the outputs.");
 
         // Configuration
         configuration.def(py::init<>())
@@ -331,16 +422,27 @@ namespace ec {
                 .def_readwrite("application", &Configuration::application)
                 .def_readwrite("functionality", &Configuration::functionality)
                 .def_readwrite("simulation", &Configuration::simulation)
+                .def_readwrite("reversible", &Configuration::reversible)
+                .def_readwrite("parameterized", &Configuration::parameterized)
+                .def_readwrite("partial_equivalence", &Configuration::partialEquivalence)
                 .def("json", &Configuration::json, "Returns a JSON-style dictionary of the configuration.")
                 .def("__repr__", &Configuration::toString, "Prints a JSON-formatted representation of the configuration.");
 
         execution.def(py::init<>())
                 .def_readwrite("parallel", &Configuration::Execution::parallel, "Set whether execution should happen in parallel. Defaults to :code:`True`.")
                 .def_readwrite("nthreads", &Configuration::Execution::nthreads, "Set the maximum number of threads to use. Defaults to the maximum number of available threads reported by the OS.")
-                .def_readwrite("timeout", &Configuration::Execution::timeout, "Set a timeout for :meth:`~.EquivalenceCheckingManager.run` (in seconds). Either a :class:`datetime.timedelta` or :class:`float`. Defaults to :code:`0.`, which means no timeout.")
+                .def_readwrite("timeout", &Configuration::Execution::timeout, "Set a timeout for :meth:`~.EquivalenceCheckingManager.run` (in seconds with millisecond resolution). Either a :class:`datetime.timedelta` or :class:`float`. Defaults to :code:`0.`, which means no timeout.")
+                .def_readwrite("time_slice", &Configuration::Execution::timeSlice, "When the checkers are not run in :attr:`~.Configuration.Execution.parallel`, interleave the simulation, alternating, and construction checker on a single thread in time slices of the given length (either a :class:`datetime.timedelta` or :class:`float` in seconds). Defaults to :code:`0.`, which means that the checkers are run one after another.")
+                .def_readwrite("simulation_budget", &Configuration::Execution::simulationBudget, "Set a time budget for all simulations within the :attr:`~.Configuration.Execution.timeout`. Once it is used up, the simulations are stopped and the remaining checkers proceed. Either a :class:`datetime.timedelta` or :class:`float` in seconds. Defaults to :code:`0.`, which means no separate budget.")
+                .def_readwrite("alternating_budget", &Configuration::Execution::alternatingBudget, "Set a time budget for the alternating checker within the :attr:`~.Configuration.Execution.timeout`. Either a :class:`datetime.timedelta` or :class:`float` in seconds. Defaults to :code:`0.`, which means no separate budget.")
+                .def_readwrite("construction_budget", &Configuration::Execution::constructionBudget, "Set a time budget for the construction checker within the :attr:`~.Configuration.Execution.timeout`. Either a :class:`datetime.timedelta` or :class:`float` in seconds. Defaults to :code:`0.`, which means no separate budget.")
                 .def_readwrite("run_construction_checker", &Configuration::Execution::runConstructionChecker, "Set whether the construction checker should be executed. Defaults to :code:`False` since the alternating checker is to be preferred in most cases.")
                 .def_readwrite("run_simulation_checker", &Configuration::Execution::runSimulationChecker, "Set whether the simulation checker should be executed. Defaults to :code:`True` since simulations can quickly show the non-equivalence of circuits in many cases.")
                 .def_readwrite("run_alternating_checker", &Configuration::Execution::runAlternatingChecker, "Set whether the alternating checker should be executed. Defaults to :code:`True` since staying close to the identity can quickly show the equivalence of circuits in many cases.")
+                .def_readwrite("run_dynamic_circuit_checker", &Configuration::Execution::runDynamicCircuitChecker, "Set whether circuits containing mid-circuit measurements, resets, or classically-controlled operations should be checked natively instead of being transformed. Defaults to :code:`False`.")
+                .def_readwrite("run_reversible_checker", &Configuration::Execution::runReversibleChecker, "Set whether circuits that only consist of (multi-)controlled X and SWAP gates should first be checked by comparing their truth tables via bit-parallel simulation. Defaults to :code:`True`.")
+                .def_readwrite("run_phase_polynomial_checker", &Configuration::Execution::runPhasePolynomialChecker, "Set whether circuits that only consist of X, CNOT, SWAP, and (singly-controlled) Z, S, T, phase, and RZ gates should be checked by comparing their linear reversible parts and phase polynomials. This decides the equivalence without decision diagrams. Defaults to :code:`True`.")
+                .def_readwrite("retain_checkers", &Configuration::Execution::retainCheckers, "Set whether the individual checkers (including their decision diagram packages) should be kept alive after they finished, e.g., for debugging purposes. Otherwise, only their statistics are kept and their memory is freed as soon as possible. Defaults to :code:`False`.")
                 .def_readwrite("numerical_tolerance", &Configuration::Execution::numericalTolerance, "Set the numerical tolerance of the underlying decision diagram package. Defaults to :code:`~2e-13` and should only be changed by users who know what they are doing.");
 
         optimizations.def(py::init<>())
@@ -366,7 +468,20 @@ namespace ec {
                 .def_readwrite("state_type", &Configuration::Simulation::stateType, "The :class:`type of states <.StateType>` used for the simulations in the simulation checker.")
                 .def_readwrite("seed", &Configuration::Simulation::seed, "The seed used in the quantum state generator. Defaults to :code:`0`, which means that the seed is chosen non-deterministically for each program run.")
                 .def_readwrite("store_cex_input", &Configuration::Simulation::storeCEXinput, "Whether to store the input state that has lead to the determination of a counterexample. Since the memory required to store a full representation of a quantum state increases exponentially, this is only recommended for a small number of qubits and defaults to :code:`False`.")
-                .def_readwrite("store_cex_output", &Configuration::Simulation::storeCEXoutput, "Whether to store the resulting states that prove the non-equivalence of both circuits. Since the memory required to store a full representation of a quantum state increases exponentially, this is only recommended for a small number of qubits and defaults to :code:`False`.");
+                .def_readwrite("store_cex_output", &Configuration::Simulation::storeCEXoutput, "Whether to store the resulting states that prove the non-equivalence of both circuits. Since the memory required to store a full representation of a quantum state increases exponentially, this is only recommended for a small number of qubits and defaults to :code:`False`.")
+                .def_readwrite("concurrent", &Configuration::Simulation::concurrent, "Whether to simulate both circuits of each simulation on separate threads (using separate decision diagram packages). This reduces the latency of individual simulations at the cost of one additional thread per simulation. In parallel checks, only half as many simulations run at the same time so that :attr:`~.Configuration.Execution.nthreads` is respected. Defaults to :code:`False`.")
+                .def_readwrite("inverse", &Configuration::Simulation::inverse, "Whether to simulate the first circuit followed by the inverse of the second circuit and compare the result to the initial state instead of simulating both circuits separately. This only keeps a single state per simulation. Circuits with garbage qubits are always simulated separately. Defaults to :code:`False`.")
+                .def_readwrite("shared_compute_table", &Configuration::Simulation::sharedComputeTable, "Whether all simulations of a check share the results of gate applications (across their decision diagram packages) via a lock-free, lossy table. This mostly pays off for parallel simulations of circuits whose states remain small for a while. The hit rate is reported in the results. Defaults to :code:`False`.");
+
+        reversible.def(py::init<>())
+                .def_readwrite("max_exhaustive_inputs", &Configuration::Reversible::maxExhaustiveInputs, "Circuits with at most this many (non-ancillary) inputs are checked for all input assignments, which proves their equivalence. Defaults to :code:`20`.")
+                .def_readwrite("n_random_stimuli", &Configuration::Reversible::nRandomStimuli, "The number of random input assignments that are checked for circuits with more inputs. Defaults to :code:`65536`.");
+
+        parameterized.def(py::init<>())
+                .def_readwrite("n_instantiations", &Configuration::Parameterized::nInstantiations, "The number of random instantiations of the parameters that are checked whenever the equivalence of the circuits cannot be shown symbolically. Defaults to :code:`8`.");
+
+        partialEquivalence.def(py::init<>())
+                .def_readwrite("relevant_outputs", &Configuration::PartialEquivalence::relevantOutputs, "The logical output qubits whose state is relevant for the equivalence. All remaining outputs are treated as garbage. Defaults to an empty list, which means that all outputs are relevant.");
 
 #ifdef VERSION_INFO
         m.attr("__version__") = VERSION_INFO;
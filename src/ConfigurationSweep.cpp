@@ -0,0 +1,170 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "ConfigurationSweep.hpp"
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace ec {
+    namespace {
+        // all options that influence the preprocessing of the circuits
+        std::string preprocessingKey(const Configuration& configuration) {
+            const auto     config = configuration.json();
+            nlohmann::json key{};
+            key["optimizations"] = config.at("optimizations");
+            key["dynamic"]       = configuration.execution.runDynamicCircuitChecker;
+            if (config.contains("partial_equivalence")) {
+                key["partial_equivalence"] = config.at("partial_equivalence");
+            }
+            return key.dump();
+        }
+
+        std::size_t maxNodes(const nlohmann::json& result) {
+            std::size_t nodes = 0U;
+            if (result.contains("checkers")) {
+                for (const auto& checker: result.at("checkers")) {
+                    if (checker.contains("max_nodes")) {
+                        nodes = std::max(nodes, checker.at("max_nodes").get<std::size_t>());
+                    }
+                }
+            }
+            return nodes;
+        }
+
+        // list all options of `config` that differ from `reference` as "section.option=value"
+        std::string difference(const nlohmann::json& config, const nlohmann::json& reference) {
+            std::string diff{};
+            for (const auto& [section, options]: config.items()) {
+                for (const auto& [option, value]: options.items()) {
+                    if (reference.contains(section) && reference.at(section).contains(option) && reference.at(section).at(option) == value) {
+                        continue;
+                    }
+                    if (!diff.empty()) {
+                        diff += ", ";
+                    }
+                    diff += section + "." + option + "=" + value.dump();
+                }
+            }
+            return diff.empty() ? "-" : diff;
+        }
+    } // namespace
+
+    nlohmann::json ConfigurationSweep::Entry::json() const {
+        nlohmann::json j{};
+        j["configuration"]      = configuration.json();
+        j["equivalence"]        = ec::toString(equivalence);
+        j["preprocessing_time"] = preprocessingTime;
+        j["check_time"]         = checkTime;
+        j["max_nodes"]          = maxNodes;
+        if (!error.empty()) {
+            j["error"] = error;
+        }
+        return j;
+    }
+
+    ConfigurationSweep::ConfigurationSweep(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, std::vector<Configuration> configurations):
+        qc1(qc1.clone()), qc2(qc2.clone()) {
+        entries.reserve(configurations.size());
+        for (auto& configuration: configurations) {
+            entries.push_back({std::move(configuration)});
+        }
+    }
+
+    void ConfigurationSweep::run() {
+        // preprocess the circuits once for every distinct preprocessing setting
+        std::map<std::string, std::pair<PreprocessedPair, double>> preprocessed{};
+        std::vector<const std::pair<PreprocessedPair, double>*>    pairs(entries.size());
+        for (std::size_t i = 0U; i < entries.size(); ++i) {
+            auto& entry = entries[i];
+            entry       = Entry{entry.configuration};
+
+            const auto key = preprocessingKey(entry.configuration);
+            auto       it  = preprocessed.find(key);
+            if (it == preprocessed.end()) {
+                try {
+                    const EquivalenceCheckingManager ecm(qc1, qc2, entry.configuration);
+                    it = preprocessed.try_emplace(key, ecm.getPreprocessedPair(), ecm.getResults().preprocessingTime).first;
+                } catch (const std::exception& e) {
+                    entry.error = e.what();
+                    continue;
+                }
+            }
+            pairs[i]                = &it->second;
+            entry.preprocessingTime = it->second.second;
+        }
+
+        // the configurations are checked one after another, so that their runtimes do not influence each other and can be
+        // compared (which `best` relies on). Each manager may still use multiple threads as configured
+        for (std::size_t i = 0U; i < entries.size(); ++i) {
+            if (pairs[i] == nullptr) {
+                continue;
+            }
+            auto& entry = entries[i];
+            try {
+                EquivalenceCheckingManager ecm(pairs[i]->first.clone(), entry.configuration);
+                ecm.run();
+                const auto results = ecm.getResults();
+                entry.equivalence  = results.equivalence;
+                entry.checkTime    = results.checkTime;
+                entry.maxNodes     = maxNodes(ecm.json());
+            } catch (const std::exception& e) {
+                entry.error = e.what();
+            }
+        }
+    }
+
+    std::optional<std::size_t> ConfigurationSweep::best() const {
+        std::optional<std::size_t> best{};
+        for (std::size_t i = 0U; i < entries.size(); ++i) {
+            const auto& entry = entries[i];
+            if (!entry.conclusive()) {
+                continue;
+            }
+            if (!best || entry.checkTime < entries[*best].checkTime ||
+                (entry.checkTime == entries[*best].checkTime && entry.maxNodes < entries[*best].maxNodes)) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    nlohmann::json ConfigurationSweep::json() const {
+        nlohmann::json j{};
+        j["circuit1"] = {{"name", qc1.getName()}, {"n_qubits", qc1.getNqubits()}, {"n_gates", qc1.getNops()}};
+        j["circuit2"] = {{"name", qc2.getName()}, {"n_qubits", qc2.getNqubits()}, {"n_gates", qc2.getNops()}};
+        auto& results = j["results"];
+        results       = nlohmann::json::array();
+        for (const auto& entry: entries) {
+            results.push_back(entry.json());
+        }
+        if (const auto b = best()) {
+            j["best"] = *b;
+        }
+        return j;
+    }
+
+    std::string ConfigurationSweep::toString() const {
+        std::ostringstream ss{};
+        ss << std::left << std::setw(5) << "#" << std::setw(30) << "equivalence" << std::right << std::setw(20) << "preprocessing [s]"
+           << std::setw(12) << "check [s]" << std::setw(12) << "max nodes" << "  " << "configuration" << "\n";
+
+        const auto reference = entries.empty() ? nlohmann::json{} : entries.front().configuration.json();
+        const auto b         = best();
+        for (std::size_t i = 0U; i < entries.size(); ++i) {
+            const auto& entry = entries[i];
+            ss << std::left << std::setw(5) << (std::to_string(i) + (b == i ? "*" : "")) << std::setw(30)
+               << (entry.error.empty() ? ec::toString(entry.equivalence) : "error") << std::right << std::fixed << std::setprecision(6)
+               << std::setw(20) << entry.preprocessingTime << std::setw(12) << entry.checkTime << std::setw(12) << entry.maxNodes << "  "
+               << (entry.error.empty() ? difference(entry.configuration.json(), reference) : entry.error) << "\n";
+        }
+        return ss.str();
+    }
+} // namespace ec
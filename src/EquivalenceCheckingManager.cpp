@@ -5,6 +5,8 @@
 
 #include "EquivalenceCheckingManager.hpp"
 
+#include <unordered_set>
+
 namespace ec {
     void EquivalenceCheckingManager::setupAncillariesAndGarbage() {
         auto&          largerCircuit   = qc1.getNqubits() > qc2.getNqubits() ? this->qc1 : this->qc2;
@@ -38,96 +40,282 @@ namespace ec {
         }
     }
 
+    void EquivalenceCheckingManager::setupRelevantOutputs() {
+        const auto        nqubits = qc1.getNqubits();
+        std::vector<bool> relevant(nqubits, false);
+        for (const auto& q: configuration.partialEquivalence.relevantOutputs) {
+            if (q < 0 || static_cast<dd::QubitCount>(q) >= nqubits) {
+                throw std::invalid_argument("Relevant output " + std::to_string(q) + " exceeds the number of qubits of the circuits.");
+            }
+            relevant[static_cast<std::size_t>(q)] = true;
+        }
+
+        // all other outputs are treated as garbage in both circuits
+        for (dd::QubitCount q = 0U; q < nqubits; ++q) {
+            if (!relevant[q]) {
+                qc1.setLogicalQubitGarbage(static_cast<dd::Qubit>(q));
+                qc2.setLogicalQubitGarbage(static_cast<dd::Qubit>(q));
+            }
+        }
+    }
+
     void EquivalenceCheckingManager::fixOutputPermutationMismatch() {
-        // Try to fix potential mismatches in output permutations
-        auto& smallerCircuit = qc1.getNqubits() > qc2.getNqubits() ? qc2 : qc1;
-        auto& largerCircuit  = qc1.getNqubits() > qc2.getNqubits() ? qc1 : qc2;
-
-        auto& smallerInitial   = smallerCircuit.initialLayout;
-        auto& smallerOutput    = smallerCircuit.outputPermutation;
-        auto& smallerAncillary = smallerCircuit.ancillary;
-        auto& smallerGarbage   = smallerCircuit.garbage;
-
-        auto& largerOutput  = largerCircuit.outputPermutation;
-        auto& largerGarbage = largerCircuit.garbage;
-
-        for (const auto& o: largerOutput) {
-            dd::Qubit outputQubitInLargerCircuit = o.second;
-            //             dd::Qubit physicalQubitInLargerCircuit = o.first;
-            //             std::cout << "Output logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << " at physical qubit " << static_cast<std::size_t>(physicalQubitInLargerCircuit);
-            dd::Qubit nout = 1;
-            for (dd::Qubit i = 0; i < outputQubitInLargerCircuit; ++i) {
-                if (!largerGarbage[i])
-                    ++nout;
-            }
-            // std::cout << " which is logical output qubit number " << static_cast<std::size_t>(nout) << std::endl;
-
-            dd::QubitCount outcount                    = nout;
-            dd::Qubit      outputQubitInSmallerCircuit = 0;
-            bool           existsInSmaller             = false;
-            for (dd::QubitCount i = 0; i < smallerCircuit.getNqubits(); ++i) {
-                if (!smallerGarbage[i]) {
-                    --outcount;
-                }
-                if (outcount == 0) {
-                    outputQubitInSmallerCircuit = static_cast<dd::Qubit>(i);
-                    existsInSmaller             = true;
-                    break;
+        // Try to infer a mismatch in the output permutations of both circuits.
+        // Given that the outputs of qc2 are just a relabeling of the (non-garbage) outputs of qc1, i.e., U2 = P U1, the combined
+        // circuit U1 U2^-1 = P^-1 maps computational basis states to computational basis states (on the non-garbage outputs).
+        // Hence, simulating the basis states |e_l> (with a single one at logical output l of qc2) through U2^-1 and U1 reveals the
+        // logical output of qc1 that corresponds to l. This requires a simulation per non-garbage output.
+        // Ancillary qubits have to start in |0>, which U2^-1 does not guarantee. Then (or if the above fails), both circuits are
+        // simulated separately for |0> and the basis states with a single one at a non-ancillary input. This works whenever all
+        // non-garbage outputs are in a basis state afterwards (e.g., for classical circuits) and the outputs can be told apart.
+        if (dynamic || parameterized) {
+            std::clog << "[QCEC] Warning: output permutation inference is not supported for dynamic or parameterized circuits." << std::endl;
+            return;
+        }
+
+        // the simulations below depend on the numerical tolerance (just as the checks in `run`)
+        const ToleranceScope tolerance(configuration.execution.numericalTolerance);
+
+        const auto nqubits = qc1.getNqubits();
+        auto       dd      = std::make_unique<SimulationDDPackage>(nqubits);
+
+        // physical qubits without a logical output are assigned to the remaining (garbage) levels
+        const auto complete = [&](qc::Permutation permutation) {
+            if (permutation.size() < nqubits) {
+                std::vector<bool> used(nqubits, false);
+                for (const auto& [physical, logical]: permutation) {
+                    used[static_cast<std::size_t>(logical)] = true;
+                }
+                dd::QubitCount next = 0U;
+                for (dd::QubitCount physical = 0U; physical < nqubits; ++physical) {
+                    if (permutation.find(static_cast<dd::Qubit>(physical)) == permutation.end()) {
+                        while (used[next]) {
+                            ++next;
+                        }
+                        used[next] = true;
+                        permutation.emplace(static_cast<dd::Qubit>(physical), static_cast<dd::Qubit>(next));
+                    }
                 }
             }
-            // algorithm has logical qubit that does not exist in the smaller circuit
-            if (!existsInSmaller)
-                continue;
+            return permutation;
+        };
+        const auto outputPermutation1 = complete(qc1.outputPermutation);
+        const auto outputPermutation2 = complete(qc2.outputPermutation);
+
+        std::vector<bool> relevant1(nqubits, false);
+        std::vector<bool> relevant2(nqubits, false);
+        bool              ancillae = false;
+        for (dd::QubitCount q = 0U; q < nqubits; ++q) {
+            relevant1[q] = !qc1.logicalQubitIsGarbage(static_cast<dd::Qubit>(q));
+            relevant2[q] = !qc2.logicalQubitIsGarbage(static_cast<dd::Qubit>(q));
+            ancillae     = ancillae || qc1.logicalQubitIsAncillary(static_cast<dd::Qubit>(q)) || qc2.logicalQubitIsAncillary(static_cast<dd::Qubit>(q));
+        }
+        if (std::count(relevant1.begin(), relevant1.end(), true) != std::count(relevant2.begin(), relevant2.end(), true)) {
+            std::clog << "[QCEC] Warning: circuits have a different number of garbage outputs. Output permutation mismatch could not be fixed." << std::endl;
+            return;
+        }
 
-            // std::cout << "This is logical qubit " << static_cast<std::size_t>(outputQubitInSmallerCircuit) << " in the smaller circuit";
-            dd::Qubit physicalQubitInSmallerCircuit = 0;
-            for (const auto& out: smallerOutput) {
-                if (out.second == outputQubitInSmallerCircuit) {
-                    physicalQubitInSmallerCircuit = out.first;
-                    break;
+        qc::VectorDD state{};
+        const auto   apply = [&](const qc::MatrixDD& op) {
+            auto saved = state;
+            state      = dd->multiply(op, state);
+            dd->incRef(state);
+            dd->decRef(saved);
+            dd->garbageCollect();
+        };
+
+        // the values of the given outputs in the current state (if all of them are in a basis state)
+        const auto readOff = [&](const std::vector<bool>& relevant) -> std::optional<std::vector<bool>> {
+            std::vector<std::int8_t>        values(nqubits, -1);
+            std::unordered_set<dd::vNode*> visited{};
+            std::vector<dd::vNode*>        stack{};
+            if (!state.isTerminal()) {
+                stack.emplace_back(state.p);
+            }
+            while (!stack.empty()) {
+                auto* const p = stack.back();
+                stack.pop_back();
+                if (!visited.insert(p).second) {
+                    continue;
+                }
+                const auto v = static_cast<std::size_t>(p->v);
+                for (std::int8_t i = 0; i < 2; ++i) {
+                    const auto& successor = p->e[static_cast<std::size_t>(i)];
+                    if (successor.w.approximatelyZero()) {
+                        continue;
+                    }
+                    if (relevant[v]) {
+                        if (values[v] >= 0 && values[v] != i) {
+                            return std::nullopt;
+                        }
+                        values[v] = i;
+                    }
+                    if (!successor.isTerminal()) {
+                        stack.emplace_back(successor.p);
+                    }
                 }
             }
-            // std::cout << " which is assigned to physical qubit " << static_cast<std::size_t>(physicalQubitInSmallerCircuit) << " at the end of the circuit" << std::endl;
-
-            //            if (outputQubitInLargerCircuit != outputQubitInSmallerCircuit) {
-            //                std::cout << "Mismatch in the logical output qubits" << std::endl;
-            //                if (smallerAncillary[outputQubitInLargerCircuit] && smallerGarbage[outputQubitInLargerCircuit]) {
-            //                    bool      found                          = false;
-            //                    dd::Qubit physicalIndexOfLargerInSmaller = 0;
-            //                    for (const auto& in: smallerInitial) {
-            //                        if (in.second == outputQubitInLargerCircuit) {
-            //                            found                          = true;
-            //                            physicalIndexOfLargerInSmaller = in.first;
-            //                            break;
-            //                        }
-            //                    }
-            // if (found) {
-            //  std::cout << "Found logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << " in smaller circuit at physical qubit " << static_cast<std::size_t>(physicalIndexOfLargerInSmaller) << std::endl;
-            //  std::cout << "This qubit is idle: " << circuit.isIdleQubit(physicalIndexOfLargerInSmaller) << std::endl;
-            // }
-            //                    if (!found || smallerCircuit.isIdleQubit(physicalIndexOfLargerInSmaller)) {
-            // std::cout << "Logical qubit " << static_cast<std::size_t>(outputQubitInSmallerCircuit) << " can be moved to logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << std::endl;
-            //                        for (auto& in: smallerInitial) {
-            //                            if (in.second == outputQubitInSmallerCircuit) {
-            //                                in.second = outputQubitInLargerCircuit;
-            // std::cout << "Physical qubit " << static_cast<std::size_t>(in.first) << " has been assigned logical qubit " << static_cast<std::size_t>(in.second) << " as input" << std::endl;
-            //                                break;
-            //                            }
-            //                        }
-            //                        smallerOutput[physicalQubitInSmallerCircuit] = outputQubitInLargerCircuit;
-            // std::cout << "Physical qubit " << static_cast<std::size_t>(physicalQubitInSmallerCircuit) << " has been assigned logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << " as output" << std::endl;
-            //                        smallerAncillary[outputQubitInLargerCircuit]  = smallerAncillary[outputQubitInSmallerCircuit];
-            //                        smallerAncillary[outputQubitInSmallerCircuit] = true;
-            // std::cout << "Logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << " was assigned the ancillary status of qubit " << static_cast<std::size_t>(outputQubitInSmallerCircuit) << " (i.e., " << smallerAncillary[outputQubitInLargerCircuit] << ")" << std::endl;
-            //                        smallerGarbage[outputQubitInLargerCircuit]  = false;
-            //                        smallerGarbage[outputQubitInSmallerCircuit] = true;
-            // std::cout << "Logical qubit " << static_cast<std::size_t>(outputQubitInLargerCircuit) << " has been removed from the garbage outputs" << std::endl;
-            //                    }
-            //                } else {
-            std::cerr << "Uncorrected mismatch in output qubits!" << std::endl;
-            //                }
-            //        }
+            std::vector<bool> result(nqubits, false);
+            for (std::size_t q = 0U; q < nqubits; ++q) {
+                result[q] = relevant[q] && values[q] == 1;
+            }
+            return result;
+        };
+
+        const auto release = [&]() {
+            dd->decRef(state);
+            dd->garbageCollect();
+        };
+
+        // sigma[l] is the logical output of qc1 that corresponds to the non-garbage logical output l of qc2
+        std::vector<dd::Qubit> sigma(nqubits, -1);
+
+        const auto inferFromCombinedCircuit = [&]() {
+            std::vector<bool> assigned(nqubits, false);
+            for (dd::QubitCount l = 0U; l < nqubits; ++l) {
+                if (!relevant2[l]) {
+                    continue;
+                }
+                // the stimulus is given w.r.t. the logical outputs of qc2
+                std::vector<bool> stimulus(nqubits, false);
+                stimulus[l] = true;
+                state       = dd->makeBasisState(nqubits, stimulus);
+                dd->incRef(state);
+
+                auto permutation2 = outputPermutation2;
+                for (auto it = qc2.rbegin(); it != qc2.rend(); ++it) {
+                    apply(dd::getInverseDD(it->get(), dd, permutation2));
+                }
+                ec::changePermutation(state, permutation2, qc2.initialLayout, dd);
+
+                auto permutation1 = qc1.initialLayout;
+                for (const auto& op: qc1) {
+                    apply(dd::getDD(op.get(), dd, permutation1));
+                }
+                ec::changePermutation(state, permutation1, outputPermutation1, dd);
+
+                const auto result = readOff(relevant1);
+                release();
+                if (!result || std::count(result->begin(), result->end(), true) != 1) {
+                    return false;
+                }
+                const auto target = static_cast<std::size_t>(std::find(result->begin(), result->end(), true) - result->begin());
+                if (assigned[target]) {
+                    return false;
+                }
+                assigned[target] = true;
+                sigma[l]         = static_cast<dd::Qubit>(target);
+            }
+            return true;
+        };
+
+        const auto inferFromSeparateSimulations = [&]() {
+            // the values of the non-garbage outputs of both circuits for each stimulus
+            std::vector<std::vector<bool>> outputs1{};
+            std::vector<std::vector<bool>> outputs2{};
+            const auto                     simulate = [&](const qc::QuantumComputation& qc, const qc::Permutation& outputPermutation, const std::vector<bool>& relevant, const std::vector<bool>& stimulus, std::vector<std::vector<bool>>& outputs) {
+                state = dd->makeBasisState(nqubits, stimulus);
+                dd->incRef(state);
+                auto permutation = qc.initialLayout;
+                for (const auto& op: qc) {
+                    apply(dd::getDD(op.get(), dd, permutation));
+                }
+                ec::changePermutation(state, permutation, outputPermutation, dd);
+                const auto result = readOff(relevant);
+                release();
+                if (!result) {
+                    return false;
+                }
+                outputs.emplace_back(*result);
+                return true;
+            };
+
+            for (dd::QubitCount i = 0U; i <= nqubits; ++i) {
+                // the first stimulus is |0>, the remaining ones set a single non-ancillary input
+                std::vector<bool> stimulus(nqubits, false);
+                if (i > 0U) {
+                    const auto input = static_cast<dd::Qubit>(i - 1U);
+                    if (qc1.logicalQubitIsAncillary(input) || qc2.logicalQubitIsAncillary(input)) {
+                        continue;
+                    }
+                    stimulus[static_cast<std::size_t>(input)] = true;
+                }
+                if (!simulate(qc1, outputPermutation1, relevant1, stimulus, outputs1) || !simulate(qc2, outputPermutation2, relevant2, stimulus, outputs2)) {
+                    return false;
+                }
+            }
+
+            // an output of qc2 corresponds to an output of qc1 that takes the same values for all stimuli.
+            // Outputs that cannot be told apart keep their relative order
+            std::vector<bool> assigned(nqubits, false);
+            for (std::size_t l = 0U; l < nqubits; ++l) {
+                if (!relevant2[l]) {
+                    continue;
+                }
+                for (std::size_t o = 0U; o < nqubits; ++o) {
+                    if (!relevant1[o] || assigned[o]) {
+                        continue;
+                    }
+                    bool matches = true;
+                    for (std::size_t k = 0U; k < outputs1.size() && matches; ++k) {
+                        matches = outputs1[k][o] == outputs2[k][l];
+                    }
+                    if (matches) {
+                        assigned[o] = true;
+                        sigma[l]    = static_cast<dd::Qubit>(o);
+                        break;
+                    }
+                }
+                if (sigma[l] < 0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        bool inferred = !ancillae && inferFromCombinedCircuit();
+        if (!inferred) {
+            std::fill(sigma.begin(), sigma.end(), -1);
+            inferred = inferFromSeparateSimulations();
         }
+        if (!inferred) {
+            // leave both circuits unchanged (as without the inference)
+            std::clog << "[QCEC] Warning: circuits do not differ by a permutation of their outputs. Output permutation mismatch could not be fixed." << std::endl;
+            return;
+        }
+
+        // the garbage outputs of qc2 are assigned to the remaining outputs of qc1 (in order)
+        std::vector<bool> assigned(nqubits, false);
+        for (const auto& target: sigma) {
+            if (target >= 0) {
+                assigned[static_cast<std::size_t>(target)] = true;
+            }
+        }
+        std::size_t next     = 0U;
+        bool        identity = true;
+        for (std::size_t l = 0U; l < nqubits; ++l) {
+            if (sigma[l] < 0) {
+                while (assigned[next]) {
+                    ++next;
+                }
+                assigned[next] = true;
+                sigma[l]       = static_cast<dd::Qubit>(next);
+            }
+            identity = identity && sigma[l] == static_cast<dd::Qubit>(l);
+        }
+
+        if (identity) {
+            return;
+        }
+
+        // relabel the outputs of qc2 accordingly
+        qc2.outputPermutation = outputPermutation2;
+        std::vector<bool> garbage(nqubits, false);
+        for (auto& [physical, logical]: qc2.outputPermutation) {
+            garbage[static_cast<std::size_t>(sigma[static_cast<std::size_t>(logical)])] = qc2.logicalQubitIsGarbage(logical);
+            logical                                                                     = sigma[static_cast<std::size_t>(logical)];
+        }
+        qc2.garbage = garbage;
     }
 
     void EquivalenceCheckingManager::runOptimizationPasses() {
@@ -137,7 +325,10 @@ namespace ec {
         const auto isDynamicCircuit1 = qc::CircuitOptimizer::isDynamicCircuit(qc1);
         const auto isDynamicCircuit2 = qc::CircuitOptimizer::isDynamicCircuit(qc2);
         if (isDynamicCircuit1 || isDynamicCircuit2) {
-            if (configuration.optimizations.transformDynamicCircuit) {
+            if (configuration.execution.runDynamicCircuitChecker) {
+                // dynamic circuit primitives are handled natively by the dynamic circuit checker
+                dynamic = true;
+            } else if (configuration.optimizations.transformDynamicCircuit) {
                 if (isDynamicCircuit1) {
                     qc::CircuitOptimizer::eliminateResets(qc1);
                     qc::CircuitOptimizer::deferMeasurements(qc1);
@@ -148,7 +339,7 @@ namespace ec {
                 }
             } else {
                 throw std::runtime_error("One of the circuits contains mid-circuit non-unitary primitives. "
-                                         "Configure your instance with `transformDynamicCircuit=true`.");
+                                         "Configure your instance with `transformDynamicCircuit=true` or `runDynamicCircuitChecker=true`.");
             }
         }
 
@@ -162,32 +353,128 @@ namespace ec {
             qc::CircuitOptimizer::swapReconstruction(qc2);
         }
 
-        if (configuration.optimizations.fuseSingleQubitGates) {
+        // fusing gates would turn symbolic operations into fixed matrices
+        if (configuration.optimizations.fuseSingleQubitGates && !parameterized) {
             qc::CircuitOptimizer::singleQubitGateFusion(qc1);
             qc::CircuitOptimizer::singleQubitGateFusion(qc2);
         }
 
-        if (configuration.optimizations.reorderOperations) {
+        // reordering does not respect the classical dependencies between measurements and classically-controlled operations
+        if (configuration.optimizations.reorderOperations && !dynamic) {
             qc::CircuitOptimizer::reorderOperations(qc1);
             qc::CircuitOptimizer::reorderOperations(qc2);
         }
 
-        // remove final measurements from both circuits so that the underlying functionality should be unitary
-        qc::CircuitOptimizer::removeFinalMeasurements(qc1);
-        qc::CircuitOptimizer::removeFinalMeasurements(qc2);
+        // merge consecutive symbolic rotations so that matching angle expressions can cancel during the check
+        if (parameterized) {
+            SymbolicOperation::mergeRotations(qc1);
+            SymbolicOperation::mergeRotations(qc2);
+        }
+
+        // remove final measurements from both circuits so that the underlying functionality should be unitary.
+        // the dynamic circuit checker compares the measurement outcomes and, hence, keeps them
+        if (!dynamic) {
+            qc::CircuitOptimizer::removeFinalMeasurements(qc1);
+            qc::CircuitOptimizer::removeFinalMeasurements(qc2);
+        }
     }
 
     void EquivalenceCheckingManager::run() {
+        // the checkers poll the deadline themselves, so that no separate timer thread is required.
+        // The timeout also covers the time spent waiting for the numerical tolerance below
+        deadline = std::chrono::steady_clock::time_point::max();
+        if (configuration.execution.timeout > 0ms) {
+            deadline = std::chrono::steady_clock::now() + configuration.execution.timeout;
+        }
+
+        // the numerical tolerance is a process-wide setting of the decision diagram package. Managers with different
+        // tolerances may still be run concurrently, but their checks do not overlap
+        const ToleranceScope tolerance(configuration.execution.numericalTolerance, deadline);
+        if (tolerance.acquired()) {
+            check();
+        } else {
+            done                = false;
+            results.equivalence = EquivalenceCriterion::NoInformation;
+            results.checkTime   = 0.;
+            results.exhaustedBudgets.clear();
+        }
+
+        // report whether the check has been cut short by the overall timeout
+        if (deadlineReached() && (results.equivalence == EquivalenceCriterion::NoInformation || results.equivalence == EquivalenceCriterion::ProbablyEquivalent)) {
+            exhaustBudget("total");
+        }
+
+        // only the statistics of the checkers are kept after the check
+        releaseCheckers();
+    }
+
+    void EquivalenceCheckingManager::releaseChecker(std::unique_ptr<EquivalenceChecker>& checker) {
+        if (!checker || configuration.execution.retainCheckers) {
+            return;
+        }
+        nlohmann::json j{};
+        checker->json(j);
+        checkerResults.emplace_back(std::move(j));
+        checker.reset();
+    }
+
+    void EquivalenceCheckingManager::check() {
         done                = false;
         results.equivalence = EquivalenceCriterion::NoInformation;
+        results.checkTime   = 0.;
+        results.exhaustedBudgets.clear();
 
         if (!configuration.anythingToExecute()) {
             std::clog << "Nothing to be executed. Check your configuration!" << std::endl;
             return;
         }
 
+        // the simulations of this check share their gate applications (if configured)
+        sharedComputeTable.reset();
+        if (configuration.simulation.sharedComputeTable && configuration.execution.runSimulationChecker) {
+            sharedComputeTable = std::make_shared<SharedComputeTable>(SHARED_COMPUTE_TABLE_CAPACITY, configuration.execution.numericalTolerance);
+        }
+
+        // the cached representations of the original circuit are identified by the preprocessed circuit
+        originalKey.clear();
+        stimulusKey.clear();
+        if (originalCache && !parameterized && !dynamic) {
+            originalKey = PreprocessedPair::serialize(originalFirst ? qc1 : qc2);
+            // the stimuli are generated for the ancillary qubits of `qc1`, which is the compiled circuit if that one has fewer gates
+            const auto nancillary = qc1.getNqubits() - qc1.getNqubitsWithoutAncillae();
+            stimulusKey           = originalKey + '\0' + std::to_string(qc1.getNqubits()) + '\0' + std::to_string(nancillary) + '\0' + (originalFirst ? '1' : '0');
+        }
+
+        if (dynamic) {
+            checkDynamicCircuits();
+            return;
+        }
+
+        if (parameterized) {
+            checkParameterized();
+            return;
+        }
+
+        if (configuration.execution.runReversibleChecker && ReversibleChecker::isReversible(qc1) && ReversibleChecker::isReversible(qc2)) {
+            checkReversible();
+            if (done || deadlineReached()) {
+                return;
+            }
+        }
+
+        if (configuration.execution.runPhasePolynomialChecker && PhasePolynomialChecker::isApplicable(qc1) && PhasePolynomialChecker::isApplicable(qc2)) {
+            checkPhasePolynomial();
+            if (done || deadlineReached()) {
+                return;
+            }
+        }
+
         if (!configuration.execution.parallel || configuration.execution.nthreads <= 1 || configuration.onlySingleTask()) {
-            checkSequential();
+            if (configuration.execution.timeSlice > 0ms && !configuration.onlySingleTask()) {
+                checkInterleaved();
+            } else {
+                checkSequential();
+            }
         } else {
             checkParallel();
         }
@@ -198,11 +485,11 @@ namespace ec {
         const auto start = std::chrono::steady_clock::now();
 
         // clone both circuits (the circuit with fewer gates always gets to be qc1)
-        this->qc1 = qc1.size() > qc2.size() ? qc2.clone() : qc1.clone();
-        this->qc2 = qc1.size() > qc2.size() ? qc1.clone() : qc2.clone();
+        originalFirst = qc1.size() <= qc2.size();
+        this->qc1     = originalFirst ? qc1.clone() : qc2.clone();
+        this->qc2     = originalFirst ? qc2.clone() : qc1.clone();
 
-        // set numeric tolerance used throughout the check
-        setTolerance(configuration.execution.numericalTolerance);
+        parameterized = SymbolicOperation::isSymbolic(this->qc1) || SymbolicOperation::isSymbolic(this->qc2);
 
         // run all configured optimization passes
         runOptimizationPasses();
@@ -224,56 +511,136 @@ namespace ec {
             fixOutputPermutationMismatch();
         }
 
+        // restrict the check to the relevant outputs (if specified)
+        if (!configuration.partialEquivalence.relevantOutputs.empty()) {
+            setupRelevantOutputs();
+        }
+
+        setupStimuli();
+
+        const auto end            = std::chrono::steady_clock::now();
+        results.preprocessingTime = std::chrono::duration<double>(end - start).count();
+    }
+
+    EquivalenceCheckingManager::EquivalenceCheckingManager(PreprocessedPair pair, const Configuration& configuration):
+        configuration(configuration) {
+        const auto start = std::chrono::steady_clock::now();
+
+        // the circuits have already been preprocessed
+        qc1     = std::move(pair.qc1);
+        qc2     = std::move(pair.qc2);
+        dynamic = pair.dynamic;
+
+        parameterized = SymbolicOperation::isSymbolic(qc1) || SymbolicOperation::isSymbolic(qc2);
+
+        // reflect the options that have actually been used during preprocessing
+        this->configuration.optimizations      = pair.optimizations;
+        this->configuration.partialEquivalence = pair.partialEquivalence;
+
+        setupStimuli();
+
+        const auto end            = std::chrono::steady_clock::now();
+        results.preprocessingTime = std::chrono::duration<double>(end - start).count();
+    }
+
+    PreprocessedPair EquivalenceCheckingManager::getPreprocessedPair() const {
+        PreprocessedPair pair{};
+        pair.qc1                = qc1.clone();
+        pair.qc2                = qc2.clone();
+        pair.dynamic            = dynamic;
+        pair.optimizations      = configuration.optimizations;
+        pair.partialEquivalence = configuration.partialEquivalence;
+        return pair;
+    }
+
+    void EquivalenceCheckingManager::setupStimuli() {
         // initialize the stimuli generator
         stateGenerator = StateGenerator(configuration.simulation.seed);
 
         // check whether the number of selected stimuli does exceed the maximum number of unique computational basis states
-        if (configuration.execution.runSimulationChecker && configuration.simulation.stateType == StateType::ComputationalBasis) {
-            const auto        nq           = this->qc1.getNqubitsWithoutAncillae();
+        if ((configuration.execution.runSimulationChecker || dynamic) && configuration.simulation.stateType == StateType::ComputationalBasis) {
+            const auto        nq           = qc1.getNqubitsWithoutAncillae();
             const std::size_t uniqueStates = 1ULL << nq;
             if (configuration.simulation.maxSims > uniqueStates) {
-                this->configuration.simulation.maxSims = uniqueStates;
+                configuration.simulation.maxSims = uniqueStates;
             }
         }
+    }
 
-        const auto end            = std::chrono::steady_clock::now();
-        results.preprocessingTime = std::chrono::duration<double>(end - start).count();
+    std::unique_ptr<DDSimulationChecker> EquivalenceCheckingManager::createSimulationChecker() {
+        auto checker = std::make_unique<DDSimulationChecker>(qc1, qc2, configuration);
+        if (sharedComputeTable) {
+            checker->setSharedComputeTable(sharedComputeTable);
+        }
+        return checker;
     }
 
-    void EquivalenceCheckingManager::checkSequential() {
-        const auto start = std::chrono::steady_clock::now();
+    template<class Checker>
+    bool EquivalenceCheckingManager::loadOriginal(Checker& checker, std::optional<std::size_t> stimulus) {
+        // without a fixed seed, the stimuli differ between managers
+        if (originalKey.empty() || (stimulus && configuration.simulation.seed == 0U)) {
+            return false;
+        }
+        auto representation = stimulus ? originalCache->getState(stimulusKey, configuration.simulation.seed, configuration.simulation.stateType, *stimulus) :
+                                         originalCache->getFunctionality(originalKey);
+        if (!representation) {
+            return false;
+        }
+        checker.setFinalRepresentation(originalFirst, std::move(*representation));
+        return true;
+    }
 
-        // in case a timeout is configured, a separate thread is started that sets the `done` flag after the timeout has passed
-        std::thread timeoutThread{};
-        if (configuration.execution.timeout > 0s) {
-            timeoutThread = std::thread([&, timeout = configuration.execution.timeout] {
-                std::unique_lock doneLock(doneMutex);
-                auto             finished = doneCond.wait_for(doneLock, timeout, [&] { return done; });
-                // if the thread has already finished within the timeout, nothing has to be done
-                if (!finished) {
-                    done = true;
-                }
-            });
+    template<class Checker>
+    void EquivalenceCheckingManager::storeOriginal(const Checker& checker, std::optional<std::size_t> stimulus) {
+        if (originalKey.empty() || (stimulus && configuration.simulation.seed == 0U)) {
+            return;
+        }
+        auto representation = checker.getFinalRepresentation(originalFirst);
+        if (representation.empty()) {
+            return;
+        }
+        if (stimulus) {
+            originalCache->storeState(stimulusKey, configuration.simulation.seed, configuration.simulation.stateType, *stimulus, std::move(representation));
+        } else {
+            originalCache->storeFunctionality(originalKey, std::move(representation));
         }
+    }
+
+    void EquivalenceCheckingManager::checkSequential() {
+        const auto start = std::chrono::steady_clock::now();
 
         if (configuration.execution.runSimulationChecker) {
-            checkers.emplace_back(std::make_unique<DDSimulationChecker>(qc1, qc2, configuration));
+            checkers.emplace_back(createSimulationChecker());
             auto* simulationChecker = dynamic_cast<DDSimulationChecker*>(checkers.back().get());
+            // the budget covers all simulations
+            const auto simulationDeadline = budgetDeadline(configuration.execution.simulationBudget, std::chrono::steady_clock::now());
+            simulationChecker->setDeadline(simulationDeadline);
             while (results.startedSimulations < configuration.simulation.maxSims && !done) {
                 // configure simulation based checker
                 simulationChecker->setRandomInitialState(stateGenerator);
+                const auto stimulus = results.startedSimulations;
+                const auto reused   = loadOriginal(*simulationChecker, stimulus);
 
                 // run the simulation
                 ++results.startedSimulations;
                 const auto result = simulationChecker->run();
                 ++results.performedSimulations;
+                if (!reused && result != EquivalenceCriterion::NoInformation) {
+                    storeOriginal(*simulationChecker, stimulus);
+                }
 
                 // if the run completed but has not yielded any information this indicates a timeout
                 if (result == EquivalenceCriterion::NoInformation) {
-                    if (!done) {
+                    if (!done && !deadlineReached()) {
+                        // the remaining checkers continue once the simulations have used up their budget
+                        if (configuration.execution.simulationBudget > 0ms && std::chrono::steady_clock::now() >= simulationDeadline) {
+                            exhaustBudget("simulation");
+                            break;
+                        }
                         std::clog << "Simulation run returned without any information. Something probably went wrong. Exiting!" << std::endl;
                     }
-                    return;
+                    done = true;
+                    break;
                 }
 
                 // break if non-equivalence has been shown
@@ -298,7 +665,6 @@ namespace ec {
 
                 // everything is done
                 done = true;
-                doneCond.notify_one();
             }
 
             // in case only simulations are performed and every single one is done, everything is done
@@ -306,14 +672,17 @@ namespace ec {
                 !configuration.execution.runConstructionChecker &&
                 results.performedSimulations == configuration.simulation.maxSims) {
                 done = true;
-                doneCond.notify_one();
             }
+
+            // free the simulation checker before any other checker is constructed
+            releaseChecker(checkers.back());
         }
 
-        if (configuration.execution.runAlternatingChecker && !done) {
+        if (configuration.execution.runAlternatingChecker && !done && !deadlineReached()) {
             checkers.emplace_back(std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration));
-            auto&      alternatingChecker = checkers.back();
-            const auto result             = alternatingChecker->run();
+            auto& alternatingChecker = checkers.back();
+            alternatingChecker->setDeadline(budgetDeadline(configuration.execution.alternatingBudget, std::chrono::steady_clock::now()));
+            const auto result = alternatingChecker->run();
 
             // if the alternating check produces a result, this is final
             if (result != EquivalenceCriterion::NoInformation) {
@@ -321,14 +690,21 @@ namespace ec {
 
                 // everything is done
                 done = true;
-                doneCond.notify_one();
+            } else if (configuration.execution.alternatingBudget > 0ms && !deadlineReached()) {
+                exhaustBudget("alternating");
             }
+            releaseChecker(alternatingChecker);
         }
 
-        if (configuration.execution.runConstructionChecker && !done) {
+        if (configuration.execution.runConstructionChecker && !done && !deadlineReached()) {
             checkers.emplace_back(std::make_unique<DDConstructionChecker>(qc1, qc2, configuration));
-            auto&      constructionChecker = checkers.back();
-            const auto result              = constructionChecker->run();
+            auto* constructionChecker = dynamic_cast<DDConstructionChecker*>(checkers.back().get());
+            constructionChecker->setDeadline(budgetDeadline(configuration.execution.constructionBudget, std::chrono::steady_clock::now()));
+            const auto reused = loadOriginal(*constructionChecker, std::nullopt);
+            const auto result = constructionChecker->run();
+            if (!reused && result != EquivalenceCriterion::NoInformation) {
+                storeOriginal(*constructionChecker, std::nullopt);
+            }
 
             // if the construction check produces a result, this is final
             if (result != EquivalenceCriterion::NoInformation) {
@@ -336,30 +712,193 @@ namespace ec {
 
                 // everything is done
                 done = true;
-                doneCond.notify_one();
+            } else if (configuration.execution.constructionBudget > 0ms && !deadlineReached()) {
+                exhaustBudget("construction");
+            }
+        }
+
+        const auto end    = std::chrono::steady_clock::now();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
+    }
+
+    void EquivalenceCheckingManager::checkInterleaved() {
+        const auto start = std::chrono::steady_clock::now();
+        const auto slice = std::chrono::duration_cast<std::chrono::steady_clock::duration>(configuration.execution.timeSlice);
+
+        // the positions of the individual checkers in `checkers` (or nothing if they are not run or have finished)
+        std::optional<std::size_t> simulation{};
+        std::optional<std::size_t> alternating{};
+        std::optional<std::size_t> construction{};
+        if (configuration.execution.runSimulationChecker && configuration.simulation.maxSims > 0U) {
+            simulation = checkers.size();
+            checkers.emplace_back(createSimulationChecker());
+        }
+        if (configuration.execution.runAlternatingChecker) {
+            alternating = checkers.size();
+            checkers.emplace_back(std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration));
+        }
+        bool constructionReused = false;
+        if (configuration.execution.runConstructionChecker) {
+            construction = checkers.size();
+            checkers.emplace_back(std::make_unique<DDConstructionChecker>(qc1, qc2, configuration));
+            constructionReused = loadOriginal(*dynamic_cast<DDConstructionChecker*>(checkers.back().get()), std::nullopt);
+        }
+        for (auto& checker: checkers) {
+            if (checker) {
+                checker->setDeadline(deadline);
+            }
+        }
+
+        // the stimulus that is currently simulated (if any)
+        std::optional<std::size_t> stimulus{};
+        bool                       simulationReused = false;
+
+        // only the time slices of a checker count against its budget
+        std::chrono::steady_clock::duration simulationUsed{};
+        std::chrono::steady_clock::duration alternatingUsed{};
+        std::chrono::steady_clock::duration constructionUsed{};
+        const auto                          resume = [&](EquivalenceChecker& checker, std::chrono::milliseconds budget, std::chrono::steady_clock::duration& used) {
+            const auto begin = std::chrono::steady_clock::now();
+            if (budget > 0ms) {
+                checker.setDeadline(std::min(deadline, begin + (budget - used)));
+            }
+            const auto finished = checker.resume(slice);
+            used += std::chrono::steady_clock::now() - begin;
+            return finished;
+        };
+        const auto exhausted = [](std::chrono::milliseconds budget, std::chrono::steady_clock::duration used) {
+            return budget > 0ms && used >= budget;
+        };
+
+        while (!done && (simulation || alternating || construction)) {
+            if (deadlineReached()) {
+                done = true;
+                break;
+            }
+
+            if (simulation) {
+                auto* simulationChecker = dynamic_cast<DDSimulationChecker*>(checkers[*simulation].get());
+                if (!stimulus) {
+                    simulationChecker->setRandomInitialState(stateGenerator);
+                    stimulus         = results.startedSimulations++;
+                    simulationReused = loadOriginal(*simulationChecker, *stimulus);
+                }
+                if (resume(*simulationChecker, configuration.execution.simulationBudget, simulationUsed)) {
+                    if (deadlineReached()) {
+                        done = true;
+                        break;
+                    }
+                    const auto result = simulationChecker->getEquivalence();
+                    if (result == EquivalenceCriterion::NoInformation && exhausted(configuration.execution.simulationBudget, simulationUsed)) {
+                        // the interrupted simulation does not count as performed
+                        exhaustBudget("simulation");
+                        releaseChecker(checkers[*simulation]);
+                        simulation.reset();
+                        continue;
+                    }
+                    ++results.performedSimulations;
+                    if (!simulationReused && result != EquivalenceCriterion::NoInformation) {
+                        storeOriginal(*simulationChecker, *stimulus);
+                    }
+                    stimulus.reset();
+
+                    if (result == EquivalenceCriterion::NotEquivalent) {
+                        results.equivalence = result;
+                        if (configuration.simulation.storeCEXinput) {
+                            results.cexInput = simulationChecker->getInitialVector();
+                        }
+                        if (configuration.simulation.storeCEXoutput) {
+                            results.cexOutput1 = simulationChecker->getInternalVector1();
+                            results.cexOutput2 = simulationChecker->getInternalVector2();
+                        }
+                        done = true;
+                        break;
+                    }
+                    results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+
+                    if (results.startedSimulations == configuration.simulation.maxSims) {
+                        releaseChecker(checkers[*simulation]);
+                        simulation.reset();
+                    }
+                }
+            }
+
+            // the alternating and the construction checker provide definitive answers once they finish
+            for (auto* position: {&alternating, &construction}) {
+                if (done || !*position) {
+                    continue;
+                }
+                const auto isConstruction = position == &construction;
+                const auto budget         = isConstruction ? configuration.execution.constructionBudget : configuration.execution.alternatingBudget;
+                auto&      used           = isConstruction ? constructionUsed : alternatingUsed;
+                auto&      checker        = checkers[**position];
+                if (!resume(*checker, budget, used)) {
+                    continue;
+                }
+                const auto result = checker->getEquivalence();
+                if (result != EquivalenceCriterion::NoInformation) {
+                    if (isConstruction && !constructionReused) {
+                        storeOriginal(*dynamic_cast<DDConstructionChecker*>(checker.get()), std::nullopt);
+                    }
+                    results.equivalence = result;
+                    done                = true;
+                } else if (exhausted(budget, used) && !deadlineReached()) {
+                    exhaustBudget(isConstruction ? "construction" : "alternating");
+                }
+                releaseChecker(checker);
+                position->reset();
             }
         }
 
         const auto end    = std::chrono::steady_clock::now();
-        results.checkTime = std::chrono::duration<double>(end - start).count();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
+    }
+
+    void EquivalenceCheckingManager::checkReversible() {
+        const auto start = std::chrono::steady_clock::now();
 
-        // appropriately join the timeout thread, if it was launched
-        if (timeoutThread.joinable()) {
-            timeoutThread.join();
+        checkers.emplace_back(std::make_unique<ReversibleChecker>(qc1, qc2, configuration));
+        auto& reversibleChecker = checkers.back();
+        reversibleChecker->setDeadline(deadline);
+        const auto result = reversibleChecker->run();
+
+        // an exhaustive comparison of the truth tables or a counterexample is final
+        if (result == EquivalenceCriterion::Equivalent || result == EquivalenceCriterion::NotEquivalent) {
+            results.equivalence = result;
+            done                = true;
+        } else if (result == EquivalenceCriterion::ProbablyEquivalent) {
+            results.equivalence = result;
         }
+
+        const auto end    = std::chrono::steady_clock::now();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
     }
 
-    void EquivalenceCheckingManager::checkParallel() {
+    void EquivalenceCheckingManager::checkPhasePolynomial() {
         const auto start = std::chrono::steady_clock::now();
 
-        std::chrono::steady_clock::time_point deadline{};
-        if (configuration.execution.timeout > 0s) {
-            deadline = start + configuration.execution.timeout;
+        checkers.emplace_back(std::make_unique<PhasePolynomialChecker>(qc1, qc2, configuration));
+        auto& phasePolynomialChecker = checkers.back();
+        phasePolynomialChecker->setDeadline(deadline);
+        const auto result = phasePolynomialChecker->run();
+
+        // the check is exact, but may be inconclusive (e.g., for garbage outputs)
+        if (result != EquivalenceCriterion::NoInformation) {
+            results.equivalence = result;
+            done                = true;
         }
 
-        const auto threadLimit = std::thread::hardware_concurrency();
-        if (threadLimit != 0 && configuration.execution.nthreads > threadLimit) {
-            std::clog << "Trying to use more threads than the underlying architecture claims to support. Over-subscription might impact performance!" << std::endl;
+        const auto end    = std::chrono::steady_clock::now();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
+    }
+
+    void EquivalenceCheckingManager::checkParallel() {
+        const auto start = std::chrono::steady_clock::now();
+
+        // the limit accounts for the CPU quota of the process (e.g., within containers)
+        const auto threadLimit = Resources::get().threads();
+        if (configuration.execution.nthreads > threadLimit) {
+            std::clog << "Trying to use more threads than are available to the process. Over-subscription might impact performance!" << std::endl;
         }
 
         const auto maxThreads      = configuration.execution.nthreads;
@@ -384,10 +923,16 @@ namespace ec {
         std::vector<std::thread> threads{};
         threads.reserve(effectiveThreads);
 
+        // the budgets of the individual checkers are measured from the start of the check
+        const auto simulationDeadline   = budgetDeadline(configuration.execution.simulationBudget, start);
+        const auto alternatingDeadline  = budgetDeadline(configuration.execution.alternatingBudget, start);
+        const auto constructionDeadline = budgetDeadline(configuration.execution.constructionBudget, start);
+
         if (runAlternating) {
             // start a new thread that constructs and runs the alternating check
             threads.emplace_back([&, id] {
                 checkers[id] = std::make_unique<DDAlternatingChecker>(qc1, qc2, configuration);
+                checkers[id]->setDeadline(alternatingDeadline);
                 checkers[id]->run();
                 queue.push(id);
             });
@@ -397,38 +942,69 @@ namespace ec {
         if (runConstruction && !done) {
             // start a new thread that constructs and runs the construction check
             threads.emplace_back([&, id] {
-                checkers[id] = std::make_unique<DDConstructionChecker>(qc1, qc2, configuration);
-                if (!done)
-                    checkers[id]->run();
+                checkers[id]      = std::make_unique<DDConstructionChecker>(qc1, qc2, configuration);
+                auto*      checker = dynamic_cast<DDConstructionChecker*>(checkers[id].get());
+                const auto reused  = loadOriginal(*checker, std::nullopt);
+                checker->setDeadline(constructionDeadline);
+                if (!done && checker->run() != EquivalenceCriterion::NoInformation && !reused) {
+                    storeOriginal(*checker, std::nullopt);
+                }
                 queue.push(id);
             });
             ++id;
         }
 
+        // the index of the next stimulus (which determines the cached output state of the original circuit)
+        std::size_t generatedStimuli = 0U;
+        const auto  simulate         = [&](std::size_t id) {
+            auto*       checker  = dynamic_cast<DDSimulationChecker*>(checkers[id].get());
+            std::size_t stimulus = 0U;
+            {
+                std::lock_guard stateGeneratorLock(stateGeneratorMutex);
+                checker->setRandomInitialState(stateGenerator);
+                stimulus = generatedStimuli++;
+            }
+            const auto reused = loadOriginal(*checker, stimulus);
+            checker->setDeadline(simulationDeadline);
+            if (!done && checker->run() != EquivalenceCriterion::NoInformation && !reused) {
+                storeOriginal(*checker, stimulus);
+            }
+            queue.push(id);
+        };
+
         if (runSimulation) {
+            // launch as many simulations as possible. Concurrent simulations occupy two threads each
             const auto effectiveThreadsLeft = effectiveThreads - threads.size();
-            // launch as many simulations as possible
-            for (std::size_t i = 0; i < effectiveThreadsLeft && !done; ++i) {
+            const auto simulationThreads    = configuration.simulation.concurrent ? std::min(effectiveThreadsLeft, std::max<std::size_t>(1U, effectiveThreadsLeft / 2U)) : effectiveThreadsLeft;
+            for (std::size_t i = 0; i < simulationThreads && !done; ++i) {
                 threads.emplace_back([&, id] {
-                    checkers[id]  = std::make_unique<DDSimulationChecker>(qc1, qc2, configuration);
-                    auto* checker = dynamic_cast<DDSimulationChecker*>(checkers[id].get());
-                    {
-                        std::lock_guard stateGeneratorLock(stateGeneratorMutex);
-                        checker->setRandomInitialState(stateGenerator);
-                    }
-                    if (!done)
-                        checkers[id]->run();
-                    queue.push(id);
+                    checkers[id] = createSimulationChecker();
+                    simulate(id);
                 });
                 ++id;
                 ++results.startedSimulations;
             }
         }
 
+        // the budget (if any) that the given checker has used up
+        const auto exhaustedBudget = [&](EquivalenceChecker* checker) -> const char* {
+            const auto now = std::chrono::steady_clock::now();
+            if (dynamic_cast<DDSimulationChecker*>(checker) != nullptr) {
+                return configuration.execution.simulationBudget > 0ms && now >= simulationDeadline ? "simulation" : nullptr;
+            }
+            if (dynamic_cast<DDAlternatingChecker*>(checker) != nullptr) {
+                return configuration.execution.alternatingBudget > 0ms && now >= alternatingDeadline ? "alternating" : nullptr;
+            }
+            return configuration.execution.constructionBudget > 0ms && now >= constructionDeadline ? "construction" : nullptr;
+        };
+        // the number of checkers that have not reported back yet and whether further simulations may be started
+        std::size_t running         = threads.size();
+        bool        simulationsLeft = true;
+
         // wait in a loop while no definitive result has been obtained
         while (!done) {
             std::shared_ptr<std::size_t> completedID{};
-            if (configuration.execution.timeout > 0s) {
+            if (configuration.execution.timeout > 0ms) {
                 completedID = queue.waitAndPopUntil(deadline);
             } else {
                 completedID = queue.waitAndPop();
@@ -443,11 +1019,28 @@ namespace ec {
             // otherwise, a checker has finished its execution
             // join the respective thread (which should return immediately)
             threads.at(*completedID).join();
+            --running;
 
             // in case non-equivalence has been shown, the execution can be stopped
             auto*      checker = checkers.at(*completedID).get();
             const auto result  = checker->getEquivalence();
             if (result == EquivalenceCriterion::NoInformation) {
+                if (deadlineReached()) {
+                    setAndSignalDone();
+                    break;
+                }
+                // a checker that has used up its budget is stopped, while the others continue
+                if (const auto* budget = exhaustedBudget(checker); budget != nullptr) {
+                    exhaustBudget(budget);
+                    if (dynamic_cast<DDSimulationChecker*>(checker) != nullptr) {
+                        simulationsLeft = false;
+                    }
+                    releaseChecker(checkers[*completedID]);
+                    if (running == 0U) {
+                        break;
+                    }
+                    continue;
+                }
                 std::clog << "Finished equivalence check provides no information. Something probably went wrong. Exiting." << std::endl;
                 break;
             }
@@ -486,19 +1079,14 @@ namespace ec {
                 ++results.performedSimulations;
 
                 // it has to be checked, whether further simulations shall be conducted
-                if (results.startedSimulations < configuration.simulation.maxSims) {
-                    threads[*completedID] = std::thread([&, id = *completedID] {
-                        {
-                            auto*           checker = dynamic_cast<DDSimulationChecker*>(checkers[id].get());
-                            std::lock_guard stateGeneratorLock(stateGeneratorMutex);
-                            checker->setRandomInitialState(stateGenerator);
-                        }
-                        if (!done)
-                            checkers[id]->run();
-                        queue.push(id);
-                    });
+                if (simulationsLeft && results.startedSimulations < configuration.simulation.maxSims) {
+                    threads[*completedID] = std::thread([&, id = *completedID] { simulate(id); });
                     ++results.startedSimulations;
+                    ++running;
                 } else {
+                    // the checker is not used for any further simulation
+                    releaseChecker(checkers[*completedID]);
+
                     // in case only simulations are performed and every single one is done, everything is done
                     if (!runAlternating && !runConstruction && results.performedSimulations == configuration.simulation.maxSims) {
                         setAndSignalDone();
@@ -506,10 +1094,15 @@ namespace ec {
                     }
                 }
             }
+
+            // all remaining checkers have used up their budgets
+            if (running == 0U) {
+                break;
+            }
         }
 
         const auto end    = std::chrono::steady_clock::now();
-        results.checkTime = std::chrono::duration<double>(end - start).count();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
 
         // cleanup threads that are still running by joining them
         // start by joining all the completed threads, which should succeed instantly
@@ -532,6 +1125,138 @@ namespace ec {
         }
     }
 
+    void EquivalenceCheckingManager::checkParameterized() {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::mt19937_64 mt{};
+        if (configuration.simulation.seed == 0U) {
+            std::random_device rd;
+            mt.seed(rd());
+        } else {
+            mt.seed(configuration.simulation.seed);
+        }
+
+        auto variables = SymbolicOperation::getVariables(qc1);
+        variables.merge(SymbolicOperation::getVariables(qc2));
+        std::uniform_real_distribution<dd::fp> angleDistribution(0., 2. * dd::PI);
+
+        // the checkers operate on instantiated copies of the preprocessed circuits, so that no preprocessing has to be repeated.
+        // all instances are created upfront since the checkers only hold references to the circuits.
+        const auto nInstantiations = std::max(configuration.parameterized.nInstantiations, static_cast<std::size_t>(1U));
+        for (std::size_t i = 0U; i < nInstantiations; ++i) {
+            VariableAssignment assignment{};
+            for (const auto& variable: variables) {
+                assignment[variable] = angleDistribution(mt);
+            }
+            auto& [inst1, inst2] = instantiatedCircuits.emplace_back(qc1.clone(), qc2.clone());
+            SymbolicOperation::instantiate(inst1, assignment);
+            SymbolicOperation::instantiate(inst2, assignment);
+        }
+
+        // try to show the equivalence symbolically. Identical symbolic operations cancel during the alternating check.
+        // if no symbolic operation had to be applied, the result does not depend on the concrete instantiation.
+        const auto offset = checkers.size();
+        checkers.resize(offset + nInstantiations);
+        checkers[offset]          = std::make_unique<DDAlternatingChecker>(instantiatedCircuits.front().first, instantiatedCircuits.front().second, configuration);
+        auto*      symbolicChecker = dynamic_cast<DDAlternatingChecker*>(checkers[offset].get());
+        symbolicChecker->setDeadline(deadline);
+        const auto result          = symbolicChecker->run();
+        ++results.performedInstantiations;
+
+        if (result == EquivalenceCriterion::NotEquivalent || (result != EquivalenceCriterion::NoInformation && symbolicChecker->isParameterIndependent())) {
+            results.equivalence = result;
+        } else if (result != EquivalenceCriterion::NoInformation) {
+            // otherwise, check the remaining random instantiations in parallel
+            results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+
+            std::atomic<std::size_t> next{1U};
+            std::mutex               checkersMutex{};
+            const auto               worker = [&] {
+                while (!done) {
+                    const auto i = next++;
+                    if (i >= nInstantiations) {
+                        return;
+                    }
+
+                    EquivalenceChecker* checker{};
+                    {
+                        std::lock_guard checkersLock(checkersMutex);
+                        if (done) {
+                            return;
+                        }
+                        const auto& [inst1, inst2] = instantiatedCircuits[i];
+                        checkers[offset + i]       = std::make_unique<DDAlternatingChecker>(inst1, inst2, configuration);
+                        checker                    = checkers[offset + i].get();
+                        checker->setDeadline(deadline);
+                    }
+
+                    const auto instanceResult = checker->run();
+
+                    std::lock_guard checkersLock(checkersMutex);
+                    if (instanceResult == EquivalenceCriterion::NoInformation) {
+                        return;
+                    }
+                    ++results.performedInstantiations;
+                    if (instanceResult == EquivalenceCriterion::NotEquivalent) {
+                        results.equivalence = EquivalenceCriterion::NotEquivalent;
+                        setAndSignalDone();
+                    }
+                }
+            };
+
+            const auto nthreads = configuration.execution.parallel ? std::min(configuration.execution.nthreads, nInstantiations - 1U) : 1U;
+            if (nthreads <= 1U) {
+                worker();
+            } else {
+                std::vector<std::thread> threads{};
+                threads.reserve(nthreads);
+                for (std::size_t t = 0U; t < nthreads; ++t) {
+                    threads.emplace_back(worker);
+                }
+                for (auto& thread: threads) {
+                    thread.join();
+                }
+            }
+        }
+
+        done = true;
+
+        const auto end    = std::chrono::steady_clock::now();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
+    }
+
+    void EquivalenceCheckingManager::checkDynamicCircuits() {
+        const auto start = std::chrono::steady_clock::now();
+
+        checkers.emplace_back(std::make_unique<DDDynamicCircuitChecker>(qc1, qc2, configuration));
+        auto* dynamicChecker = dynamic_cast<DDDynamicCircuitChecker*>(checkers.back().get());
+        dynamicChecker->setDeadline(deadline);
+        while (results.startedSimulations < configuration.simulation.maxSims && !done) {
+            dynamicChecker->setRandomInitialState(stateGenerator);
+
+            ++results.startedSimulations;
+            const auto result = dynamicChecker->run();
+            if (result == EquivalenceCriterion::NoInformation) {
+                break;
+            }
+            ++results.performedSimulations;
+
+            // break if non-equivalence has been shown
+            if (result == EquivalenceCriterion::NotEquivalent) {
+                results.equivalence = EquivalenceCriterion::NotEquivalent;
+                break;
+            }
+
+            // Otherwise, circuits are probably equivalent and execution can continue
+            results.equivalence = EquivalenceCriterion::ProbablyEquivalent;
+        }
+
+        done = true;
+
+        const auto end    = std::chrono::steady_clock::now();
+        results.checkTime += std::chrono::duration<double>(end - start).count();
+    }
+
     nlohmann::json EquivalenceCheckingManager::json() const {
         nlohmann::json res{};
 
@@ -539,14 +1264,23 @@ namespace ec {
         addCircuitDescription(qc2, res["circuit2"]);
         res["configuration"] = configuration.json();
         res["results"]       = results.json();
+        // the detected resources that determined the default number of threads and simulations. They are specific to the
+        // machine and, hence, reported with the results of a run rather than as part of the (reproducible) configuration
+        res["resources"] = Resources::get().json();
+        if (sharedComputeTable) {
+            res["results"]["shared_compute_table"] = sharedComputeTable->json();
+        }
 
-        if (!checkers.empty()) {
-            res["checkers"]      = nlohmann::json::array();
-            auto& checkerResults = res["checkers"];
+        if (!checkerResults.empty() || !checkers.empty()) {
+            res["checkers"]  = checkerResults;
+            auto& statistics = res["checkers"];
             for (auto& checker: checkers) {
+                if (!checker) {
+                    continue;
+                }
                 nlohmann::json j{};
                 checker->json(j);
-                checkerResults.push_back(j);
+                statistics.push_back(j);
             }
         }
         return res;
@@ -603,6 +1337,14 @@ namespace ec {
             }
         }
 
+        if (performedInstantiations > 0) {
+            res["parameterized"]["performed_instantiations"] = performedInstantiations;
+        }
+
+        if (!exhaustedBudgets.empty()) {
+            res["exhausted_budgets"] = exhaustedBudgets;
+        }
+
         return res;
     }
 } // namespace ec
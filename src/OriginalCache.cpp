@@ -0,0 +1,60 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "OriginalCache.hpp"
+
+namespace ec {
+    std::optional<std::string> OriginalCache::getState(const std::string& original, std::size_t seed, StateType type, std::size_t index) {
+        const std::lock_guard lock(mutex);
+        if (const auto entry = entries.find(original); entry != entries.end()) {
+            if (const auto it = entry->second.states.find({seed, type, index}); it != entry->second.states.end()) {
+                ++hits;
+                return it->second;
+            }
+        }
+        ++misses;
+        return std::nullopt;
+    }
+
+    void OriginalCache::storeState(const std::string& original, std::size_t seed, StateType type, std::size_t index, std::string state) {
+        const std::lock_guard lock(mutex);
+        entries[original].states.try_emplace({seed, type, index}, std::move(state));
+    }
+
+    std::optional<std::string> OriginalCache::getFunctionality(const std::string& original) {
+        const std::lock_guard lock(mutex);
+        if (const auto entry = entries.find(original); entry != entries.end() && entry->second.functionality) {
+            ++hits;
+            return entry->second.functionality;
+        }
+        ++misses;
+        return std::nullopt;
+    }
+
+    void OriginalCache::storeFunctionality(const std::string& original, std::string functionality) {
+        const std::lock_guard lock(mutex);
+        auto&                 entry = entries[original];
+        if (!entry.functionality) {
+            entry.functionality = std::move(functionality);
+        }
+    }
+
+    std::size_t OriginalCache::getHits() const {
+        const std::lock_guard lock(mutex);
+        return hits;
+    }
+
+    std::size_t OriginalCache::getMisses() const {
+        const std::lock_guard lock(mutex);
+        return misses;
+    }
+
+    void OriginalCache::clear() {
+        const std::lock_guard lock(mutex);
+        entries.clear();
+        hits   = 0U;
+        misses = 0U;
+    }
+} // namespace ec
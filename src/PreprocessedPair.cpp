@@ -0,0 +1,430 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "PreprocessedPair.hpp"
+
+#include "parameterized/SymbolicOperation.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ec {
+    namespace {
+        constexpr char          MAGIC[8]        = {'Q', 'C', 'E', 'C', 'P', 'A', 'I', 'R'};
+        constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304U;
+
+        enum class OperationKind: std::uint8_t {
+            Standard,
+            NonUnitary,
+            Compound,
+            ClassicControlled
+        };
+
+        class Writer {
+        public:
+            explicit Writer(std::ostream& os):
+                os(os) {}
+
+            template<class T>
+            void write(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            void write(const std::string& str) {
+                write(static_cast<std::uint32_t>(str.size()));
+                os.write(str.data(), static_cast<std::streamsize>(str.size()));
+            }
+
+            void write(const qc::Permutation& permutation) {
+                write(static_cast<std::uint32_t>(permutation.size()));
+                for (const auto& [physical, logical]: permutation) {
+                    write(static_cast<std::int32_t>(physical));
+                    write(static_cast<std::int32_t>(logical));
+                }
+            }
+
+            void write(const std::vector<bool>& flags) {
+                write(static_cast<std::uint32_t>(flags.size()));
+                for (const auto flag: flags) {
+                    write(static_cast<std::uint8_t>(flag));
+                }
+            }
+
+            void write(const qc::Operation& op) {
+                if (SymbolicOperation::isSymbolic(op)) {
+                    throw std::invalid_argument("Circuits with symbolic parameters cannot be serialized.");
+                }
+
+                if (const auto* classic = dynamic_cast<const qc::ClassicControlledOperation*>(&op)) {
+                    write(OperationKind::ClassicControlled);
+                    const auto& [start, length] = classic->getControlRegister();
+                    write(static_cast<std::uint64_t>(start));
+                    write(static_cast<std::uint64_t>(length));
+                    write(static_cast<std::uint32_t>(classic->getExpectedValue()));
+                    write(*classic->getOperation());
+                    return;
+                }
+
+                if (const auto* compound = dynamic_cast<const qc::CompoundOperation*>(&op)) {
+                    write(OperationKind::Compound);
+                    write(static_cast<std::uint32_t>(op.getNqubits()));
+                    write(static_cast<std::uint64_t>(compound->size()));
+                    for (const auto& o: *compound) {
+                        write(*o);
+                    }
+                    return;
+                }
+
+                const auto* nonUnitary = dynamic_cast<const qc::NonUnitaryOperation*>(&op);
+                write(nonUnitary != nullptr ? OperationKind::NonUnitary : OperationKind::Standard);
+                write(static_cast<std::uint8_t>(op.getType()));
+                write(static_cast<std::uint32_t>(op.getNqubits()));
+
+                write(static_cast<std::uint32_t>(op.getTargets().size()));
+                for (const auto& target: op.getTargets()) {
+                    write(static_cast<std::int32_t>(target));
+                }
+
+                if (nonUnitary != nullptr) {
+                    write(static_cast<std::uint64_t>(nonUnitary->getClassics().size()));
+                    for (const auto& bit: nonUnitary->getClassics()) {
+                        write(static_cast<std::uint64_t>(bit));
+                    }
+                    return;
+                }
+
+                write(static_cast<std::uint32_t>(op.getControls().size()));
+                for (const auto& control: op.getControls()) {
+                    write(static_cast<std::int32_t>(control.qubit));
+                    write(static_cast<std::uint8_t>(control.type == dd::Control::Type::pos));
+                }
+                for (const auto& parameter: op.getParameter()) {
+                    write(parameter);
+                }
+            }
+
+            void write(const qc::QuantumComputation& qc) {
+                write(qc.getName());
+                write(static_cast<std::uint32_t>(qc.getNqubitsWithoutAncillae()));
+                write(static_cast<std::uint32_t>(qc.getNancillae()));
+                write(static_cast<std::uint64_t>(qc.getNcbits()));
+                write(qc.initialLayout);
+                write(qc.outputPermutation);
+                write(qc.ancillary);
+                write(qc.garbage);
+                write(static_cast<std::uint64_t>(qc.getNops()));
+                for (const auto& op: qc) {
+                    write(*op);
+                }
+            }
+
+        private:
+            std::ostream& os;
+        };
+
+        class Reader {
+        public:
+            Reader(const char* data, std::size_t size):
+                data(data), size(size) {}
+
+            template<class T>
+            T read() {
+                static_assert(std::is_trivially_copyable_v<T>);
+                require(sizeof(T));
+                T value{};
+                std::memcpy(&value, data + offset, sizeof(T));
+                offset += sizeof(T);
+                return value;
+            }
+
+            std::string readString() {
+                const auto length = read<std::uint32_t>();
+                require(length);
+                std::string str(data + offset, length);
+                offset += length;
+                return str;
+            }
+
+            // read the number of subsequent elements and make sure that the data actually contains them
+            template<class Count>
+            std::size_t readCount(std::size_t elementSize) {
+                const auto count = static_cast<std::size_t>(read<Count>());
+                if (count > (size - offset) / elementSize) {
+                    throw std::runtime_error("Unexpected end of preprocessed pair data.");
+                }
+                return count;
+            }
+
+            dd::Qubit readQubit() {
+                return static_cast<dd::Qubit>(read<std::int32_t>());
+            }
+
+            qc::Permutation readPermutation() {
+                qc::Permutation permutation{};
+                const auto      entries = read<std::uint32_t>();
+                for (std::uint32_t i = 0U; i < entries; ++i) {
+                    const auto physical = readQubit();
+                    permutation.emplace(physical, readQubit());
+                }
+                return permutation;
+            }
+
+            std::vector<bool> readFlags() {
+                std::vector<bool> flags(readCount<std::uint32_t>(sizeof(std::uint8_t)));
+                for (auto&& flag: flags) {
+                    flag = read<std::uint8_t>() != 0U;
+                }
+                return flags;
+            }
+
+            std::unique_ptr<qc::Operation> readOperation() {
+                const auto kind = read<OperationKind>();
+                switch (kind) {
+                    case OperationKind::ClassicControlled: {
+                        const auto start         = read<std::uint64_t>();
+                        const auto length        = read<std::uint64_t>();
+                        const auto expectedValue = read<std::uint32_t>();
+                        auto       op            = readOperation();
+                        return std::make_unique<qc::ClassicControlledOperation>(op, qc::ClassicalRegister{start, length}, expectedValue);
+                    }
+                    case OperationKind::Compound: {
+                        const auto                                  nqubits = static_cast<dd::QubitCount>(read<std::uint32_t>());
+                        const auto                                  nops    = read<std::uint64_t>();
+                        std::vector<std::unique_ptr<qc::Operation>> ops{};
+                        for (std::uint64_t i = 0U; i < nops; ++i) {
+                            ops.emplace_back(readOperation());
+                        }
+                        return std::make_unique<qc::CompoundOperation>(nqubits, std::move(ops));
+                    }
+                    case OperationKind::Standard:
+                    case OperationKind::NonUnitary:
+                        break;
+                    default:
+                        throw std::runtime_error("Unknown operation kind in preprocessed pair data.");
+                }
+
+                const auto  type    = static_cast<qc::OpType>(read<std::uint8_t>());
+                const auto  nqubits = static_cast<dd::QubitCount>(read<std::uint32_t>());
+                qc::Targets targets(readCount<std::uint32_t>(sizeof(std::int32_t)));
+                for (auto& target: targets) {
+                    target = readQubit();
+                }
+
+                if (kind == OperationKind::NonUnitary) {
+                    std::vector<std::size_t> classics(readCount<std::uint64_t>(sizeof(std::uint64_t)));
+                    for (auto& bit: classics) {
+                        bit = read<std::uint64_t>();
+                    }
+                    if (type == qc::Measure) {
+                        return std::make_unique<qc::NonUnitaryOperation>(nqubits, targets, classics);
+                    }
+                    return std::make_unique<qc::NonUnitaryOperation>(nqubits, targets, type);
+                }
+
+                dd::Controls controls{};
+                const auto   ncontrols = read<std::uint32_t>();
+                for (std::uint32_t i = 0U; i < ncontrols; ++i) {
+                    const auto qubit = readQubit();
+                    controls.emplace(dd::Control{qubit, read<std::uint8_t>() != 0U ? dd::Control::Type::pos : dd::Control::Type::neg});
+                }
+                std::array<dd::fp, qc::MAX_PARAMETERS> parameter{};
+                for (auto& p: parameter) {
+                    p = read<dd::fp>();
+                }
+
+                // the operation is restored as is (without normalizing the gate again)
+                auto op = std::make_unique<qc::StandardOperation>();
+                op->setNqubits(nqubits);
+                op->setGate(type);
+                op->setTargets(targets);
+                op->setControls(controls);
+                op->setParameter(parameter);
+                return op;
+            }
+
+            qc::QuantumComputation readCircuit() {
+                qc::QuantumComputation qc{};
+                qc.setName(readString());
+                const auto nqubits   = read<std::uint32_t>();
+                const auto nancillae = read<std::uint32_t>();
+                const auto nclassics = read<std::uint64_t>();
+                if (nqubits > 0U) {
+                    qc.addQubitRegister(nqubits);
+                }
+                if (nancillae > 0U) {
+                    qc.addAncillaryRegister(nancillae);
+                }
+                if (nclassics > 0U) {
+                    qc.addClassicalRegister(nclassics);
+                }
+                qc.initialLayout     = readPermutation();
+                qc.outputPermutation = readPermutation();
+                qc.ancillary         = readFlags();
+                qc.garbage           = readFlags();
+
+                const auto nops = read<std::uint64_t>();
+                for (std::uint64_t i = 0U; i < nops; ++i) {
+                    qc.emplace_back(readOperation());
+                }
+                return qc;
+            }
+
+        private:
+            const char* data;
+            std::size_t size;
+            std::size_t offset = 0U;
+
+            void require(std::size_t bytes) const {
+                if (size - offset < bytes) {
+                    throw std::runtime_error("Unexpected end of preprocessed pair data.");
+                }
+            }
+        };
+
+        std::uint32_t encodeOptimizations(const Configuration::Optimizations& optimizations) {
+            std::uint32_t bits = 0U;
+            bits |= static_cast<std::uint32_t>(optimizations.fixOutputPermutationMismatch) << 0U;
+            bits |= static_cast<std::uint32_t>(optimizations.fuseSingleQubitGates) << 1U;
+            bits |= static_cast<std::uint32_t>(optimizations.reconstructSWAPs) << 2U;
+            bits |= static_cast<std::uint32_t>(optimizations.removeDiagonalGatesBeforeMeasure) << 3U;
+            bits |= static_cast<std::uint32_t>(optimizations.transformDynamicCircuit) << 4U;
+            bits |= static_cast<std::uint32_t>(optimizations.reorderOperations) << 5U;
+            return bits;
+        }
+
+        Configuration::Optimizations decodeOptimizations(std::uint32_t bits) {
+            Configuration::Optimizations optimizations{};
+            optimizations.fixOutputPermutationMismatch     = (bits & (1U << 0U)) != 0U;
+            optimizations.fuseSingleQubitGates             = (bits & (1U << 1U)) != 0U;
+            optimizations.reconstructSWAPs                 = (bits & (1U << 2U)) != 0U;
+            optimizations.removeDiagonalGatesBeforeMeasure = (bits & (1U << 3U)) != 0U;
+            optimizations.transformDynamicCircuit          = (bits & (1U << 4U)) != 0U;
+            optimizations.reorderOperations                = (bits & (1U << 5U)) != 0U;
+            return optimizations;
+        }
+    } // namespace
+
+    PreprocessedPair PreprocessedPair::clone() const {
+        PreprocessedPair pair{};
+        pair.qc1                = qc1.clone();
+        pair.qc2                = qc2.clone();
+        pair.dynamic            = dynamic;
+        pair.optimizations      = optimizations;
+        pair.partialEquivalence = partialEquivalence;
+        return pair;
+    }
+
+    void PreprocessedPair::write(std::ostream& os) const {
+        Writer writer(os);
+        os.write(MAGIC, sizeof(MAGIC));
+        writer.write(VERSION);
+        writer.write(BYTE_ORDER_MARK);
+        writer.write(static_cast<std::uint32_t>(dynamic));
+        writer.write(encodeOptimizations(optimizations));
+        writer.write(static_cast<std::uint32_t>(partialEquivalence.relevantOutputs.size()));
+        for (const auto& q: partialEquivalence.relevantOutputs) {
+            writer.write(static_cast<std::int32_t>(q));
+        }
+        writer.write(qc1);
+        writer.write(qc2);
+        if (!os.good()) {
+            throw std::runtime_error("Could not write preprocessed pair.");
+        }
+    }
+
+    void PreprocessedPair::write(const std::string& filename) const {
+        std::ofstream ofs(filename, std::ios::binary);
+        if (!ofs.good()) {
+            throw std::runtime_error("Could not open file " + filename);
+        }
+        write(ofs);
+    }
+
+    std::string PreprocessedPair::serialize() const {
+        std::ostringstream oss(std::ios::binary);
+        write(oss);
+        return oss.str();
+    }
+
+    std::string PreprocessedPair::serialize(const qc::QuantumComputation& qc) {
+        std::ostringstream oss(std::ios::binary);
+        Writer             writer(oss);
+        writer.write(qc);
+        return oss.str();
+    }
+
+    PreprocessedPair PreprocessedPair::read(const char* data, std::size_t size) {
+        if (size < sizeof(MAGIC) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("Data does not contain a preprocessed pair.");
+        }
+        Reader reader(data + sizeof(MAGIC), size - sizeof(MAGIC));
+
+        const auto version = reader.read<std::uint32_t>();
+        if (version != VERSION) {
+            throw std::runtime_error("Unsupported version " + std::to_string(version) + " of preprocessed pair data (expected version " + std::to_string(VERSION) + ").");
+        }
+        if (reader.read<std::uint32_t>() != BYTE_ORDER_MARK) {
+            throw std::runtime_error("Preprocessed pair data has been written on a machine with a different byte order.");
+        }
+
+        PreprocessedPair pair{};
+        pair.dynamic       = reader.read<std::uint32_t>() != 0U;
+        pair.optimizations = decodeOptimizations(reader.read<std::uint32_t>());
+        pair.partialEquivalence.relevantOutputs.resize(reader.readCount<std::uint32_t>(sizeof(std::int32_t)));
+        for (auto& q: pair.partialEquivalence.relevantOutputs) {
+            q = reader.readQubit();
+        }
+        pair.qc1 = reader.readCircuit();
+        pair.qc2 = reader.readCircuit();
+        return pair;
+    }
+
+    PreprocessedPair PreprocessedPair::read(const std::string& filename) {
+#ifdef _WIN32
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs.good()) {
+            throw std::runtime_error("Could not open file " + filename);
+        }
+        const std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        return read(data.data(), data.size());
+#else
+        const auto fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open file " + filename);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) < 0 || st.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not read file " + filename);
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        auto*      data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("Could not map file " + filename);
+        }
+
+        try {
+            auto pair = read(static_cast<const char*>(data), size);
+            ::munmap(data, size);
+            return pair;
+        } catch (...) {
+            ::munmap(data, size);
+            throw;
+        }
+#endif
+    }
+} // namespace ec
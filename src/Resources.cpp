@@ -0,0 +1,145 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Resources.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace ec {
+    namespace {
+        // values at least this large denote the absence of a limit (cgroup v1 reports a page-aligned maximum)
+        constexpr std::size_t UNLIMITED = 1ULL << 60U;
+
+        std::optional<std::string> readLine(const std::string& path) {
+            std::ifstream ifs(path);
+            std::string   line{};
+            if (!ifs.good() || !std::getline(ifs, line)) {
+                return std::nullopt;
+            }
+            return line;
+        }
+
+        std::optional<long long> readNumber(const std::string& path) {
+            const auto line = readLine(path);
+            if (!line) {
+                return std::nullopt;
+            }
+            try {
+                return std::stoll(*line);
+            } catch (const std::exception&) {
+                return std::nullopt;
+            }
+        }
+
+        // the directories that may hold the cgroup v2 limits of the process, from the most specific one to the root
+        std::vector<std::string> unifiedDirectories(const std::string& root) {
+            std::vector<std::string> directories{};
+            std::ifstream            ifs("/proc/self/cgroup");
+            for (std::string line{}; std::getline(ifs, line);) {
+                // the entry of the unified hierarchy reads "0::<path>"
+                if (line.rfind("0::", 0) == 0 && line.size() > 4U) {
+                    auto path = line.substr(3U);
+                    while (!path.empty() && path != "/") {
+                        directories.emplace_back(root + path);
+                        path.erase(path.find_last_of('/'));
+                    }
+                }
+            }
+            directories.emplace_back(root);
+            return directories;
+        }
+
+        std::size_t schedulableThreads() {
+#ifdef __linux__
+            cpu_set_t set{};
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                return std::max(1, CPU_COUNT(&set));
+            }
+#endif
+            return std::max(1U, std::thread::hardware_concurrency());
+        }
+    } // namespace
+
+    std::size_t Resources::threads(std::size_t reserved) const noexcept {
+        auto available = hardwareThreads;
+        if (cpuQuota) {
+            available = std::min(available, static_cast<std::size_t>(std::max(1., std::ceil(*cpuQuota))));
+        }
+        return available > reserved ? available - reserved : 1U;
+    }
+
+    nlohmann::json Resources::json() const {
+        nlohmann::json j{};
+        j["hardware_threads"] = hardwareThreads;
+        j["threads"]          = threads();
+        if (cpuQuota) {
+            j["cpu_quota"] = *cpuQuota;
+        }
+        if (memoryLimit) {
+            j["memory_limit"] = *memoryLimit;
+        }
+        return j;
+    }
+
+    const Resources& Resources::get() {
+        static const Resources resources = detect();
+        return resources;
+    }
+
+    Resources Resources::detect(const std::string& cgroupRoot) {
+        Resources resources{};
+        resources.hardwareThreads = schedulableThreads();
+
+        // cgroup v2: the effective limits are the tightest ones along the hierarchy
+        for (const auto& directory: unifiedDirectories(cgroupRoot)) {
+            try {
+                if (const auto cpu = readLine(directory + "/cpu.max")) {
+                    // "<quota> <period>" or "max <period>"
+                    std::istringstream iss(*cpu);
+                    std::string        quota{};
+                    double             period = 0.;
+                    if ((iss >> quota >> period) && quota != "max" && period > 0.) {
+                        const auto cpus    = std::stod(quota) / period;
+                        resources.cpuQuota = resources.cpuQuota ? std::min(*resources.cpuQuota, cpus) : cpus;
+                    }
+                }
+                if (const auto memory = readLine(directory + "/memory.max"); memory && *memory != "max") {
+                    const auto bytes      = static_cast<std::size_t>(std::stoull(*memory));
+                    resources.memoryLimit = resources.memoryLimit ? std::min(*resources.memoryLimit, bytes) : bytes;
+                }
+            } catch (const std::exception&) {
+                // malformed entries are ignored
+            }
+        }
+
+        // cgroup v1
+        if (!resources.cpuQuota) {
+            for (const auto* controller: {"/cpu", "/cpu,cpuacct"}) {
+                const auto quota  = readNumber(cgroupRoot + controller + "/cpu.cfs_quota_us");
+                const auto period = readNumber(cgroupRoot + controller + "/cpu.cfs_period_us");
+                if (quota && period && *quota > 0 && *period > 0) {
+                    resources.cpuQuota = static_cast<double>(*quota) / static_cast<double>(*period);
+                    break;
+                }
+            }
+        }
+        if (!resources.memoryLimit) {
+            const auto limit = readNumber(cgroupRoot + "/memory/memory.limit_in_bytes");
+            if (limit && *limit > 0 && static_cast<std::size_t>(*limit) < UNLIMITED) {
+                resources.memoryLimit = static_cast<std::size_t>(*limit);
+            }
+        }
+        return resources;
+    }
+} // namespace ec
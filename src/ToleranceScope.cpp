@@ -0,0 +1,73 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "ToleranceScope.hpp"
+
+#include "dd/Package.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace ec {
+    namespace {
+        struct ToleranceState {
+            std::mutex              mutex{};
+            std::condition_variable released{};
+            // the number of active scopes (all of which use the current tolerance)
+            std::size_t active = 0U;
+            // the tickets of the scopes waiting to become active (in the order of their arrival)
+            std::deque<std::size_t> waiting{};
+            std::size_t             nextTicket = 0U;
+            dd::fp                  current    = dd::ComplexTable<>::tolerance();
+        };
+
+        ToleranceState& state() {
+            static ToleranceState s{};
+            return s;
+        }
+    } // namespace
+
+    ToleranceScope::ToleranceScope(dd::fp tolerance, std::chrono::steady_clock::time_point deadline) {
+        auto&             s = state();
+        std::unique_lock lock(s.mutex);
+        const auto        ticket = s.nextTicket++;
+        s.waiting.emplace_back(ticket);
+
+        const auto ready = [&] { return s.waiting.front() == ticket && (s.active == 0U || tolerance == s.current); };
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            s.released.wait(lock, ready);
+        } else if (!s.released.wait_until(lock, deadline, ready)) {
+            // give up the place in the queue, which might allow the scopes behind to proceed
+            s.waiting.erase(std::find(s.waiting.begin(), s.waiting.end(), ticket));
+            s.released.notify_all();
+            return;
+        }
+
+        s.waiting.pop_front();
+        if (s.active == 0U) {
+            s.current = tolerance;
+            dd::ComplexTable<>::setTolerance(tolerance);
+        }
+        ++s.active;
+        entered = true;
+        // the next scope in line might use the same tolerance
+        s.released.notify_all();
+    }
+
+    ToleranceScope::~ToleranceScope() {
+        if (!entered) {
+            return;
+        }
+        auto&           s = state();
+        std::lock_guard lock(s.mutex);
+        --s.active;
+        if (s.active == 0U) {
+            s.released.notify_all();
+        }
+    }
+} // namespace ec
@@ -79,13 +79,19 @@ namespace ec {
                 if (isDone()) { return; }
                 taskManager2.advance(functionality, apply2);
             }
+            if (sliceEnded()) { return; }
         }
     }
 
     void DDAlternatingChecker::finish() {
-        taskManager1.finish(functionality);
-        if (isDone()) { return; }
-        taskManager2.finish(functionality);
+        while (!taskManager1.finished() && !isDone()) {
+            taskManager1.advance(functionality);
+            if (sliceEnded()) { return; }
+        }
+        while (!taskManager2.finished() && !isDone()) {
+            taskManager2.advance(functionality);
+            if (sliceEnded()) { return; }
+        }
     }
 
     void DDAlternatingChecker::postprocess() {
@@ -93,7 +99,7 @@ namespace ec {
         taskManager1.changePermutation(functionality);
         if (isDone()) { return; }
         taskManager2.changePermutation(functionality);
-        if (done) { return; }
+        if (isDone()) { return; }
 
         // sum up the contributions of garbage qubits
         taskManager1.reduceGarbage(functionality);
@@ -140,7 +146,15 @@ namespace ec {
         const auto& op1 = *taskManager1();
         const auto& op2 = *taskManager2();
 
-        return op1.equals(op2);
+        // SWAPs are only tracked in the permutations, so the operations have to act on the same levels of the decision diagram
+        const auto& perm1 = taskManager1.getPermutation();
+        const auto& perm2 = taskManager2.getPermutation();
+
+        // symbolic operations have to be compared based on their parameter expressions and not just their current instantiation
+        if (SymbolicOperation::isSymbolic(op2)) {
+            return op2.equals(op1, perm2, perm1);
+        }
+        return op1.equals(op2, perm1, perm2);
     }
 
 } // namespace ec
@@ -0,0 +1,304 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "checker/dd/DDDynamicCircuitChecker.hpp"
+
+namespace ec {
+    DDDynamicCircuitChecker::DDDynamicCircuitChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration):
+        EquivalenceChecker(qc1, qc2, configuration),
+        dd(std::make_unique<SimulationDDPackage>(nqubits)) {
+        initialState = dd->makeZeroState(nqubits);
+    }
+
+    void DDDynamicCircuitChecker::setRandomInitialState(StateGenerator& generator) {
+        const auto nancillary = nqubits - qc1.getNqubitsWithoutAncillae();
+        initialState          = generator.generateRandomState(dd, nqubits, nancillary, configuration.simulation.stateType);
+    }
+
+    EquivalenceCriterion DDDynamicCircuitChecker::run() {
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto release = [&](std::vector<Branch>& branches) {
+            for (auto& branch: branches) {
+                dd->decRef(branch.state);
+            }
+            branches.clear();
+        };
+
+        // outputs that have been measured or reset (and not acted upon afterwards) in the respective circuit
+        std::vector<bool> observed1(nqubits, false);
+        std::vector<bool> observed2(nqubits, false);
+
+        auto branches1 = simulate(qc1, observed1);
+        if (isDone()) {
+            release(branches1);
+            return equivalence;
+        }
+        auto branches2 = simulate(qc2, observed2);
+        if (isDone()) {
+            release(branches1);
+            release(branches2);
+            return equivalence;
+        }
+
+        // an output may only be disregarded if it holds the (classically known) result of a measurement or reset in both circuits
+        std::vector<bool> observed(nqubits, false);
+        for (std::size_t q = 0U; q < observed.size(); ++q) {
+            observed[q] = observed1[q] && observed2[q];
+        }
+
+        equivalence = compare(branches1, branches2, observed);
+
+        // adjust reference counts to facilitate reuse of the checker
+        release(branches1);
+        release(branches2);
+        dd->garbageCollect();
+
+        maxActiveNodes = dd->vUniqueTable.getMaxActiveNodes();
+
+        const auto end = std::chrono::steady_clock::now();
+        runtime += std::chrono::duration<double>(end - start).count();
+
+        return equivalence;
+    }
+
+    std::vector<DDDynamicCircuitChecker::Branch> DDDynamicCircuitChecker::simulate(const qc::QuantumComputation& qc, std::vector<bool>& observed) {
+        const auto          nbits = std::max(qc1.getNcbits(), qc2.getNcbits());
+        std::vector<Branch> branches{Branch{std::vector<bool>(nbits, false), initialState, 1.}};
+        dd->incRef(initialState);
+
+        // the levels that hold the result of a measurement or reset which has not been acted upon since
+        std::vector<bool> measured(nqubits, false);
+
+        auto       permutation = qc.initialLayout;
+        const auto touch       = [&](const qc::Operation& op) {
+            for (const auto& target: op.getTargets()) {
+                measured[static_cast<std::size_t>(permutation.at(target))] = false;
+            }
+            for (const auto& control: op.getControls()) {
+                measured[static_cast<std::size_t>(permutation.at(control.qubit))] = false;
+            }
+        };
+
+        for (const auto& op: qc) {
+            if (isDone()) {
+                break;
+            }
+
+            if (op->getType() == qc::SWAP && !op->isControlled()) {
+                // SWAP operations only change the tracked permutation
+                const auto& targets = op->getTargets();
+                std::swap(permutation.at(targets[0]), permutation.at(targets[1]));
+                continue;
+            }
+
+            if (op->isUnitary()) {
+                touch(*op);
+                const auto opDD = dd::getDD(op.get(), dd, permutation);
+                for (auto& branch: branches) {
+                    apply(opDD, branch);
+                }
+            } else if (op->isClassicControlledOperation()) {
+                const auto* classicOp          = dynamic_cast<const qc::ClassicControlledOperation*>(op.get());
+                const auto [regStart, regSize] = classicOp->getControlRegister();
+                const auto expectedValue       = classicOp->getExpectedValue();
+                const auto opDD                = dd::getDD(classicOp->getOperation().get(), dd, permutation);
+                touch(*classicOp->getOperation());
+                for (auto& branch: branches) {
+                    std::size_t value = 0U;
+                    for (std::size_t i = 0U; i < regSize; ++i) {
+                        if (branch.classicalValues[regStart + i]) {
+                            value |= (1ULL << i);
+                        }
+                    }
+                    if (value == expectedValue) {
+                        apply(opDD, branch);
+                    }
+                }
+                mergeBranches(branches);
+            } else if (op->getType() == qc::Measure) {
+                const auto* measureOp = dynamic_cast<const qc::NonUnitaryOperation*>(op.get());
+                const auto& qubits    = measureOp->getTargets();
+                const auto& bits      = measureOp->getClassics();
+                for (std::size_t i = 0U; i < qubits.size(); ++i) {
+                    measure(branches, permutation.at(qubits[i]), bits[i]);
+                    measured[static_cast<std::size_t>(permutation.at(qubits[i]))] = true;
+                }
+            } else if (op->getType() == qc::Reset) {
+                for (const auto& qubit: op->getTargets()) {
+                    reset(branches, permutation.at(qubit));
+                    measured[static_cast<std::size_t>(permutation.at(qubit))] = true;
+                }
+            }
+            // any other non-unitary operation (barriers, snapshots, etc.) does not affect the state
+
+            dd->garbageCollect();
+            maxBranches = std::max(maxBranches, branches.size());
+        }
+
+        // ensure that the permutation that was tracked throughout the circuit matches the expected output permutation
+        auto outputs = permutation;
+        for (auto& branch: branches) {
+            outputs = permutation;
+            ec::changePermutation(branch.state, outputs, qc.outputPermutation, dd);
+        }
+
+        // the measured levels are mapped to the outputs they end up at
+        for (const auto& [qubit, level]: permutation) {
+            if (measured[static_cast<std::size_t>(level)]) {
+                observed[static_cast<std::size_t>(outputs.at(qubit))] = true;
+            }
+        }
+
+        return branches;
+    }
+
+    void DDDynamicCircuitChecker::apply(const qc::MatrixDD& op, Branch& branch) {
+        auto saved   = branch.state;
+        branch.state = dd->multiply(op, branch.state);
+        dd->incRef(branch.state);
+        dd->decRef(saved);
+    }
+
+    void DDDynamicCircuitChecker::measure(std::vector<Branch>& branches, dd::Qubit level, std::size_t bit) {
+        std::vector<Branch> result{};
+        result.reserve(2U * branches.size());
+        for (auto& branch: branches) {
+            const auto p0 = outcomeProbability(branch.state, level, false);
+            for (const bool outcome: {false, true}) {
+                const auto probability = outcome ? 1. - p0 : p0;
+                if (probability < configuration.execution.numericalTolerance) {
+                    continue;
+                }
+                auto& b = result.emplace_back(Branch{branch.classicalValues, project(branch.state, level, outcome, probability, false), branch.probability * probability});
+                b.classicalValues[bit] = outcome;
+                dd->incRef(b.state);
+            }
+            dd->decRef(branch.state);
+        }
+        branches = std::move(result);
+        mergeBranches(branches);
+    }
+
+    void DDDynamicCircuitChecker::reset(std::vector<Branch>& branches, dd::Qubit level) {
+        std::vector<Branch> result{};
+        result.reserve(2U * branches.size());
+        for (auto& branch: branches) {
+            const auto p0 = outcomeProbability(branch.state, level, false);
+            for (const bool outcome: {false, true}) {
+                const auto probability = outcome ? 1. - p0 : p0;
+                if (probability < configuration.execution.numericalTolerance) {
+                    continue;
+                }
+                auto& b = result.emplace_back(Branch{branch.classicalValues, project(branch.state, level, outcome, probability, true), branch.probability * probability});
+                dd->incRef(b.state);
+            }
+            dd->decRef(branch.state);
+        }
+        branches = std::move(result);
+        mergeBranches(branches);
+    }
+
+    void DDDynamicCircuitChecker::mergeBranches(std::vector<Branch>& branches) {
+        // all branch states are normalized. Hence, branches with the same classical values and the same root node only
+        // differ by a global phase and represent the same physical state. Their probabilities can be combined.
+        std::vector<Branch>                                              merged{};
+        std::map<std::pair<std::vector<bool>, dd::vNode*>, std::size_t> lookup{};
+        for (auto& branch: branches) {
+            const auto [it, inserted] = lookup.try_emplace({branch.classicalValues, branch.state.p}, merged.size());
+            if (inserted) {
+                merged.emplace_back(std::move(branch));
+            } else {
+                merged[it->second].probability += branch.probability;
+                dd->decRef(branch.state);
+            }
+        }
+        branches = std::move(merged);
+    }
+
+    dd::fp DDDynamicCircuitChecker::outcomeProbability(const qc::VectorDD& state, dd::Qubit level, bool outcome) {
+        const auto matrix    = outcome ? dd::GateMatrix{dd::complex_zero, dd::complex_zero, dd::complex_zero, dd::complex_one} : dd::GateMatrix{dd::complex_one, dd::complex_zero, dd::complex_zero, dd::complex_zero};
+        const auto projector = dd->makeGateDD(matrix, nqubits, level);
+        const auto projected = dd->multiply(projector, state);
+        return dd->innerProduct(projected, projected).r;
+    }
+
+    qc::VectorDD DDDynamicCircuitChecker::project(const qc::VectorDD& state, dd::Qubit level, bool outcome, dd::fp probability, bool reset) {
+        // the projector is scaled such that the resulting state is normalized
+        const auto     norm = dd::ComplexValue{1. / std::sqrt(probability), 0.};
+        dd::GateMatrix matrix{dd::complex_zero, dd::complex_zero, dd::complex_zero, dd::complex_zero};
+        if (!outcome) {
+            matrix[0] = norm; // |0><0|
+        } else if (reset) {
+            matrix[1] = norm; // |0><1|
+        } else {
+            matrix[3] = norm; // |1><1|
+        }
+        const auto projector = dd->makeGateDD(matrix, nqubits, level);
+        return dd->multiply(projector, state);
+    }
+
+    EquivalenceCriterion DDDynamicCircuitChecker::compare(std::vector<Branch>& branches1, std::vector<Branch>& branches2, const std::vector<bool>& observed) {
+        // the states of garbage qubits as well as measured or reset qubits are not considered. They are traced out by
+        // branching over their basis values (just as for measurements) and moving each of them to |0> afterwards.
+        // Summing up the amplitudes of both values instead would let them interfere and does not yield the reduced state.
+        for (dd::QubitCount q = 0U; q < nqubits; ++q) {
+            const auto qubit = static_cast<dd::Qubit>(q);
+            if (observed[q] || qc1.logicalQubitIsGarbage(qubit) || qc2.logicalQubitIsGarbage(qubit)) {
+                reset(branches1, qubit);
+                reset(branches2, qubit);
+            }
+        }
+
+        // group the branches of both circuits by their classical outcome
+        std::map<std::vector<bool>, std::pair<std::vector<Branch>, std::vector<Branch>>> outcomes{};
+        for (const auto& branch: branches1) {
+            outcomes[branch.classicalValues].first.emplace_back(branch);
+        }
+        for (const auto& branch: branches2) {
+            outcomes[branch.classicalValues].second.emplace_back(branch);
+        }
+
+        // for two ensembles {(p_i, a_i)} and {(q_j, b_j)}, the squared Frobenius distance between the corresponding density matrices is
+        // sum_ij p_i p_j |<a_i|a_j>|^2 + sum_ij q_i q_j |<b_i|b_j>|^2 - 2 sum_ij p_i q_j |<a_i|b_j>|^2
+        const auto overlap = [&](const std::vector<Branch>& lhs, const std::vector<Branch>& rhs) {
+            dd::fp sum = 0.;
+            for (const auto& l: lhs) {
+                for (const auto& r: rhs) {
+                    const auto ip = dd->innerProduct(l.state, r.state);
+                    sum += l.probability * r.probability * (ip.r * ip.r + ip.i * ip.i);
+                }
+            }
+            return sum;
+        };
+        const auto totalProbability = [](const std::vector<Branch>& branches) {
+            dd::fp sum = 0.;
+            for (const auto& branch: branches) {
+                sum += branch.probability;
+            }
+            return sum;
+        };
+
+        auto result = EquivalenceCriterion::Equivalent;
+        for (const auto& [values, ensembles]: outcomes) {
+            const auto& [ensemble1, ensemble2] = ensembles;
+
+            // the probability of observing the classical outcome has to match
+            if (std::abs(totalProbability(ensemble1) - totalProbability(ensemble2)) > configuration.simulation.fidelityThreshold) {
+                result = EquivalenceCriterion::NotEquivalent;
+                break;
+            }
+
+            // the resulting states have to match
+            const auto distance = overlap(ensemble1, ensemble1) + overlap(ensemble2, ensemble2) - 2. * overlap(ensemble1, ensemble2);
+            if (std::abs(distance) > configuration.simulation.fidelityThreshold) {
+                result = EquivalenceCriterion::NotEquivalent;
+                break;
+            }
+        }
+
+        return result;
+    }
+} // namespace ec
@@ -5,6 +5,8 @@
 
 #include "checker/dd/DDEquivalenceChecker.hpp"
 
+#include <sstream>
+
 namespace ec {
 
     template<class DDType, class DDPackage>
@@ -56,18 +58,23 @@ namespace ec {
         } else {
             // for vectors this is resolved by computing the inner product (or fidelity) between both decision
             // diagrams and comparing it to some threshold
-            const auto innerProduct = dd->innerProduct(e, f);
+            return fromInnerProduct(dd->innerProduct(e, f));
+        }
 
-            // whenever <e,f> ≃ 1, both decision diagrams should be considered equivalent
-            if (std::abs(innerProduct.r - 1.) < configuration.simulation.fidelityThreshold) {
-                return EquivalenceCriterion::Equivalent;
-            }
+        return EquivalenceCriterion::NotEquivalent;
+    }
 
-            // whenever |<e,f>|^2 ≃ 1, both decision diagrams should be considered equivalent up to a phase
-            const auto fidelity = innerProduct.r * innerProduct.r + innerProduct.i * innerProduct.i;
-            if (std::abs(fidelity - 1.0) < configuration.simulation.fidelityThreshold) {
-                return EquivalenceCriterion::EquivalentUpToPhase;
-            }
+    template<class DDType, class DDPackage>
+    EquivalenceCriterion DDEquivalenceChecker<DDType, DDPackage>::fromInnerProduct(const dd::ComplexValue& innerProduct) const {
+        // whenever <e,f> ≃ 1, both decision diagrams should be considered equivalent
+        if (std::abs(innerProduct.r - 1.) < configuration.simulation.fidelityThreshold) {
+            return EquivalenceCriterion::Equivalent;
+        }
+
+        // whenever |<e,f>|^2 ≃ 1, both decision diagrams should be considered equivalent up to a phase
+        const auto fidelity = innerProduct.r * innerProduct.r + innerProduct.i * innerProduct.i;
+        if (std::abs(fidelity - 1.0) < configuration.simulation.fidelityThreshold) {
+            return EquivalenceCriterion::EquivalentUpToPhase;
         }
 
         return EquivalenceCriterion::NotEquivalent;
@@ -75,27 +82,71 @@ namespace ec {
 
     template<class DDType, class DDPackage>
     EquivalenceCriterion DDEquivalenceChecker<DDType, DDPackage>::run() {
-        const auto start = std::chrono::steady_clock::now();
+        stage    = Stage::Initialize;
+        sliceEnd = std::chrono::steady_clock::time_point::max();
+        proceed();
+        return equivalence;
+    }
 
-        // initialize the internal representation (initial state, initial matrix, etc.)
-        initialize();
+    template<class DDType, class DDPackage>
+    bool DDEquivalenceChecker<DDType, DDPackage>::resume(std::chrono::steady_clock::duration slice) {
+        if (stage == Stage::Done) {
+            stage = Stage::Initialize;
+        }
+        sliceEnd = std::chrono::steady_clock::now() + slice;
+        return proceed();
+    }
 
-        if (isDone()) { return equivalence; }
+    template<class DDType, class DDPackage>
+    bool DDEquivalenceChecker<DDType, DDPackage>::proceed() {
+        const auto start = std::chrono::steady_clock::now();
+        const auto stop  = [&](bool finished) {
+            if (finished) {
+                stage = Stage::Done;
+            }
+            const auto end = std::chrono::steady_clock::now();
+            runtime += std::chrono::duration<double>(end - start).count();
+            return finished;
+        };
+
+        if (stage == Stage::Initialize) {
+            // an interrupted check must not report the result of a previous one
+            equivalence = EquivalenceCriterion::NoInformation;
+
+            // initialize the internal representation (initial state, initial matrix, etc.)
+            initialize();
+            stage = Stage::Execute;
+        }
+
+        if (stage == Stage::Execute) {
+            if (isDone()) { return stop(true); }
 
-        // execute the equivalence checking scheme
-        execute();
+            // execute the equivalence checking scheme
+            execute();
 
-        if (isDone()) { return equivalence; }
+            if (isDone()) { return stop(true); }
+            if (!taskManager1.finished() && !taskManager2.finished()) {
+                // the time slice has ended
+                return stop(false);
+            }
+            stage = Stage::Finish;
+        }
 
-        // finish off both circuits
-        finish();
+        if (stage == Stage::Finish) {
+            // finish off both circuits
+            finish();
 
-        if (isDone()) { return equivalence; }
+            if (isDone()) { return stop(true); }
+            if (!taskManager1.finished() || !taskManager2.finished()) {
+                return stop(false);
+            }
+            stage = Stage::Compare;
+        }
 
         // postprocess the result
         postprocess();
 
-        if (isDone()) { return equivalence; }
+        if (isDone()) { return stop(true); }
 
         // check the equivalence
         equivalence = checkEquivalence();
@@ -107,16 +158,31 @@ namespace ec {
             maxActiveNodes = dd->vUniqueTable.getMaxActiveNodes();
         }
 
-        const auto end = std::chrono::steady_clock::now();
-        runtime += std::chrono::duration<double>(end - start).count();
-
-        return equivalence;
+        return stop(true);
     }
 
     template<class DDType, class DDPackage>
     void DDEquivalenceChecker<DDType, DDPackage>::initialize() {
         initializeTask(taskManager1);
         initializeTask(taskManager2);
+
+        reusedTask = nullptr;
+        if (cachedRepresentation) {
+            auto& task = cachedRepresentation->first ? taskManager1 : taskManager2;
+
+            using Node = std::remove_pointer_t<decltype(DDType{}.p)>;
+            std::istringstream iss(cachedRepresentation->second, std::ios::binary);
+            const auto         representation = dd->template deserialize<Node>(iss, true);
+            cachedRepresentation.reset();
+
+            // the representation already includes all postprocessing, so that the task is done
+            task.decRef();
+            task.setInternalState(representation);
+            task.incRef();
+            task.skip();
+            reusedTask = &task;
+            ++reusedRepresentations;
+        }
     }
 
     template<class DDType, class DDPackage>
@@ -136,14 +202,20 @@ namespace ec {
                 if (isDone()) { return; }
                 taskManager2.advance(apply2);
             }
+            if (sliceEnded()) { return; }
         }
     }
 
     template<class DDType, class DDPackage>
     void DDEquivalenceChecker<DDType, DDPackage>::finish() {
-        taskManager1.finish();
-        if (isDone()) { return; }
-        taskManager2.finish();
+        while (!taskManager1.finished() && !isDone()) {
+            taskManager1.advance();
+            if (sliceEnded()) { return; }
+        }
+        while (!taskManager2.finished() && !isDone()) {
+            taskManager2.advance();
+            if (sliceEnded()) { return; }
+        }
     }
 
     template<class DDType, class DDPackage>
@@ -160,9 +232,20 @@ namespace ec {
 
     template<class DDType, class DDPackage>
     void DDEquivalenceChecker<DDType, DDPackage>::postprocess() {
-        postprocessTask(taskManager1);
+        if (reusedTask != &taskManager1) {
+            postprocessTask(taskManager1);
+        }
         if (isDone()) { return; }
-        postprocessTask(taskManager2);
+        if (reusedTask != &taskManager2) {
+            postprocessTask(taskManager2);
+        }
+    }
+
+    template<class DDType, class DDPackage>
+    std::string DDEquivalenceChecker<DDType, DDPackage>::getFinalRepresentation(bool first) const {
+        std::ostringstream oss(std::ios::binary);
+        dd::serialize((first ? taskManager1 : taskManager2).getInternalState(), oss, true);
+        return oss.str();
     }
 
     template<class DDType, class DDPackage>
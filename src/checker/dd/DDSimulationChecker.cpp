@@ -5,14 +5,104 @@
 
 #include "checker/dd/DDSimulationChecker.hpp"
 
+#include <algorithm>
+#include <complex>
+#include <exception>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 namespace ec {
+    namespace {
+        struct NodePairHash {
+            std::size_t operator()(const std::pair<const dd::vNode*, const dd::vNode*>& nodes) const noexcept {
+                const auto h1 = std::hash<const dd::vNode*>{}(nodes.first);
+                const auto h2 = std::hash<const dd::vNode*>{}(nodes.second);
+                return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6U) + (h1 >> 2U));
+            }
+        };
+        using InnerProductTable = std::unordered_map<std::pair<const dd::vNode*, const dd::vNode*>, std::complex<dd::fp>, NodePairHash>;
+
+        std::complex<dd::fp> value(const dd::Complex& c) {
+            return {dd::CTEntry::val(c.r), dd::CTEntry::val(c.i)};
+        }
+
+        // the inner product of the (unit-weight) vectors represented by nodes from different packages.
+        // since the nodes cannot be compared, the package's compute tables cannot be used. Instead, results are memoized per pair of nodes
+        std::complex<dd::fp> innerProduct(const dd::vNode* x, const dd::vNode* y, InnerProductTable& computed) {
+            if (dd::vNode::isTerminal(x) || dd::vNode::isTerminal(y)) {
+                if (dd::vNode::isTerminal(x) != dd::vNode::isTerminal(y)) {
+                    throw std::runtime_error("Cannot compute the inner product of vectors with different numbers of qubits.");
+                }
+                return 1.;
+            }
+            if (const auto it = computed.find({x, y}); it != computed.end()) {
+                return it->second;
+            }
+
+            std::complex<dd::fp> result = 0.;
+            for (std::size_t i = 0U; i < x->e.size(); ++i) {
+                if (x->e[i].w.approximatelyZero() || y->e[i].w.approximatelyZero()) {
+                    continue;
+                }
+                result += std::conj(value(x->e[i].w)) * value(y->e[i].w) * innerProduct(x->e[i].p, y->e[i].p, computed);
+            }
+            computed.emplace(std::pair{x, y}, result);
+            return result;
+        }
+
+        // the amplitude of `state` corresponding to `basis`, or nothing if `basis` is not a computational basis state.
+        // For basis states, this only requires following a single path instead of computing a full inner product
+        std::optional<std::complex<dd::fp>> basisAmplitude(const qc::VectorDD& basis, const qc::VectorDD& state) {
+            auto amplitude = std::conj(value(basis.w)) * value(state.w);
+            auto x         = basis.p;
+            auto y         = state.p;
+            while (!dd::vNode::isTerminal(x)) {
+                const auto& e = x->e;
+                if (!e[0].w.approximatelyZero() && !e[1].w.approximatelyZero()) {
+                    return std::nullopt;
+                }
+                if (state.w.approximatelyZero()) {
+                    // keep checking whether `basis` is a basis state
+                    x = e[0].w.approximatelyZero() ? e[1].p : e[0].p;
+                    continue;
+                }
+                if (dd::vNode::isTerminal(y)) {
+                    throw std::runtime_error("Cannot compare vectors with different numbers of qubits.");
+                }
+                const auto i = e[0].w.approximatelyZero() ? 1U : 0U;
+                amplitude *= std::conj(value(e[i].w)) * value(y->e[i].w);
+                x = e[i].p;
+                y = y->e[i].p;
+            }
+            return amplitude;
+        }
+    } // namespace
+
     DDSimulationChecker::DDSimulationChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration) noexcept:
-        DDEquivalenceChecker(qc1, qc2, configuration) {
+        DDEquivalenceChecker(qc1, qc2, configuration),
+        concurrentTask(qc2, concurrentDD) {
         initialState = dd->makeZeroState(nqubits);
         initializeApplicationScheme(this->configuration.application.simulationScheme);
+        if (this->configuration.simulation.concurrent) {
+            concurrentDD = std::make_unique<SimulationDDPackage>(nqubits);
+        }
+        const auto noGarbage = [](const qc::QuantumComputation& qc) { return std::none_of(qc.garbage.begin(), qc.garbage.end(), [](bool g) { return g; }); };
+        invertible           = noGarbage(qc1) && noGarbage(qc2);
+    }
+
+    void DDSimulationChecker::setSharedComputeTable(std::shared_ptr<SharedComputeTable> table) {
+        sharedTable.emplace(std::move(table), dd);
+        taskManager1.setSharedTable(&*sharedTable, 0U);
+        taskManager2.setSharedTable(&*sharedTable, 1U);
     }
 
     void DDSimulationChecker::initializeTask(TaskManager<qc::VectorDD, SimulationDDPackage>& task) {
+        // the checker is reused for multiple stimuli
+        task.reset();
         task.setInternalState(initialState);
         task.incRef();
     }
@@ -27,6 +117,189 @@ namespace ec {
         return equivalence;
     }
 
+    void DDSimulationChecker::selectMode() {
+        // a reused final state of the second circuit is of no use for the inverse simulation
+        inverseRun = configuration.simulation.inverse && invertible && !(cachedRepresentation && !cachedRepresentation->first);
+        // a reused final state leaves only a single circuit to be simulated
+        concurrentRun = !inverseRun && concurrentDD && !cachedRepresentation;
+    }
+
+    EquivalenceCriterion DDSimulationChecker::run() {
+        selectMode();
+        if (inverseRun || concurrentRun) {
+            // these simulations are always run to completion
+            stage       = Stage::Done;
+            equivalence = EquivalenceCriterion::NoInformation;
+        }
+        if (inverseRun) {
+            return runInverse();
+        }
+        if (concurrentRun) {
+            return runConcurrently();
+        }
+        return DDEquivalenceChecker::run();
+    }
+
+    bool DDSimulationChecker::resume(std::chrono::steady_clock::duration slice) {
+        if (stage == Stage::Initialize || stage == Stage::Done) {
+            selectMode();
+            if (inverseRun || concurrentRun) {
+                run();
+                return true;
+            }
+        }
+        return DDEquivalenceChecker::resume(slice);
+    }
+
+    void DDSimulationChecker::simulate(TaskManager<qc::VectorDD, SimulationDDPackage>& task) {
+        while (!task.finished() && !isDone()) {
+            task.advance();
+        }
+        if (isDone()) {
+            return;
+        }
+        postprocessTask(task);
+    }
+
+    EquivalenceCriterion DDSimulationChecker::runConcurrently() {
+        const auto start = std::chrono::steady_clock::now();
+
+        // the initial state has to be transferred to the package of the second circuit
+        std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        dd::serialize(initialState, ss, true);
+        const auto initialState2 = concurrentDD->deserialize<dd::vNode>(ss, true);
+
+        initializeTask(taskManager1);
+        concurrentTask.reset();
+        concurrentTask.setInternalState(initialState2);
+        concurrentTask.incRef();
+
+        // exceptions must not escape the second thread. They are rethrown once both simulations have stopped
+        std::exception_ptr failure1{};
+        std::exception_ptr failure2{};
+        std::thread        second([&] {
+            try {
+                simulate(concurrentTask);
+            } catch (...) {
+                failure2 = std::current_exception();
+                signalDone();
+            }
+        });
+        try {
+            simulate(taskManager1);
+        } catch (...) {
+            failure1 = std::current_exception();
+            signalDone();
+        }
+        second.join();
+        if (failure1 || failure2) {
+            taskManager1.decRef();
+            concurrentTask.decRef();
+            std::rethrow_exception(failure1 ? failure1 : failure2);
+        }
+
+        if (!isDone()) {
+            InnerProductTable computed{};
+            const auto&       state1 = taskManager1.getInternalState();
+            const auto&       state2 = concurrentTask.getInternalState();
+            auto              ip     = std::conj(value(state1.w)) * value(state2.w) * innerProduct(state1.p, state2.p, computed);
+            if (state1.w.approximatelyZero() || state2.w.approximatelyZero()) {
+                ip = 0.;
+            }
+            equivalence = fromInnerProduct({ip.real(), ip.imag()});
+
+            maxActiveNodes = std::max(dd->vUniqueTable.getMaxActiveNodes(), concurrentDD->vUniqueTable.getMaxActiveNodes());
+        }
+
+        // adjust reference counts to facilitate reuse of the simulation checker
+        taskManager1.decRef();
+        concurrentTask.decRef();
+
+        const auto end = std::chrono::steady_clock::now();
+        runtime += std::chrono::duration<double>(end - start).count();
+        return equivalence;
+    }
+
+    void DDSimulationChecker::applyInverse(qc::VectorDD& state) {
+        // the permutation at the end of the second circuit, i.e., the one that has been reconciled with its output permutation
+        auto permutation = qc2.initialLayout;
+        for (const auto& op: qc2) {
+            if (op->getType() == qc::SWAP && !op->isControlled()) {
+                const auto& targets = op->getTargets();
+                std::swap(permutation.at(targets[0]), permutation.at(targets[1]));
+            }
+        }
+        auto outputPermutation = qc2.outputPermutation;
+        ec::changePermutation(state, outputPermutation, permutation, dd);
+
+        for (auto it = qc2.rbegin(); it != qc2.rend() && !isDone(); ++it) {
+            const auto& op = *it;
+            if (op->getType() == qc::SWAP && !op->isControlled()) {
+                const auto& targets = op->getTargets();
+                std::swap(permutation.at(targets[0]), permutation.at(targets[1]));
+                continue;
+            }
+            auto saved = state;
+            state      = dd->multiply(dd::getInverseDD(op.get(), dd, permutation), state);
+            dd->incRef(state);
+            dd->decRef(saved);
+            dd->garbageCollect();
+        }
+    }
+
+    EquivalenceCriterion DDSimulationChecker::runInverse() {
+        const auto start = std::chrono::steady_clock::now();
+
+        // the second task keeps the initial state for the final comparison. It has to stay referenced for the whole run,
+        // since the first task releases its reference to the initial state as soon as it applies the first operation
+        dd->incRef(initialState);
+        initialize();
+        taskManager2.decRef();
+        taskManager2.setInternalState(initialState);
+
+        while (!taskManager1.finished() && !isDone()) {
+            taskManager1.advance();
+        }
+        if (!isDone() && reusedTask != &taskManager1) {
+            postprocessTask(taskManager1);
+        }
+
+        // the final state of the first circuit is directly transformed further
+        auto state = taskManager1.getInternalState();
+        if (!isDone()) {
+            applyInverse(state);
+        }
+        taskManager1.setInternalState(state);
+
+        if (!isDone()) {
+            const auto amplitude = basisAmplitude(initialState, state);
+            if (amplitude) {
+                equivalence = fromInnerProduct({amplitude->real(), amplitude->imag()});
+            } else {
+                equivalence = fromInnerProduct(dd->innerProduct(initialState, state));
+            }
+            maxActiveNodes = dd->vUniqueTable.getMaxActiveNodes();
+        }
+        dd->decRef(state);
+        dd->decRef(initialState);
+
+        const auto end = std::chrono::steady_clock::now();
+        runtime += std::chrono::duration<double>(end - start).count();
+        return equivalence;
+    }
+
+    std::string DDSimulationChecker::getFinalRepresentation(bool first) const {
+        if (inverseRun) {
+            return {};
+        }
+        if (first || !concurrentRun) {
+            return DDEquivalenceChecker::getFinalRepresentation(first);
+        }
+        std::ostringstream oss(std::ios::binary);
+        dd::serialize(concurrentTask.getInternalState(), oss, true);
+        return oss.str();
+    }
+
     void DDSimulationChecker::setRandomInitialState(StateGenerator& generator) {
         const auto nancillary = nqubits - qc1.getNqubitsWithoutAncillae();
         initialState          = generator.generateRandomState(dd, nqubits, nancillary, configuration.simulation.stateType);
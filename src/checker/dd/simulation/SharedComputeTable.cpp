@@ -0,0 +1,251 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "checker/dd/simulation/SharedComputeTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace ec {
+    namespace {
+        std::size_t roundUpToPowerOfTwo(std::size_t n) {
+            std::size_t result = 1U;
+            while (result < n) {
+                result <<= 1U;
+            }
+            return result;
+        }
+
+        std::complex<dd::fp> value(const dd::Complex& c) {
+            return {dd::CTEntry::val(c.r), dd::CTEntry::val(c.i)};
+        }
+    } // namespace
+
+    SharedComputeTable::SharedComputeTable(std::size_t capacity, dd::fp tolerance):
+        tolerance(tolerance),
+        mask(roundUpToPowerOfTwo(std::max<std::size_t>(capacity, MAX_PROBES)) - 1U),
+        uniqueTable(mask + 1U),
+        computeTable(mask + 1U) {
+        if (tolerance <= 0.) {
+            throw std::invalid_argument("The tolerance of the shared compute table must be positive.");
+        }
+    }
+
+    SharedComputeTable::Key SharedComputeTable::key(const Node& node) const {
+        const auto round = [this](dd::fp x) { return static_cast<std::int64_t>(std::llround(x / tolerance)); };
+        return {node.v,
+                static_cast<std::int64_t>(node.children[0]), static_cast<std::int64_t>(node.children[1]),
+                round(node.weights[0].real()), round(node.weights[0].imag()),
+                round(node.weights[1].real()), round(node.weights[1].imag())};
+    }
+
+    std::size_t SharedComputeTable::hash(const Key& key) {
+        std::size_t h = 0U;
+        for (const auto& k: key) {
+            h ^= std::hash<std::int64_t>{}(k) + 0x9e3779b97f4a7c15ULL + (h << 6U) + (h >> 2U);
+        }
+        return h;
+    }
+
+    std::optional<SharedComputeTable::NodeID> SharedComputeTable::intern(const Node& node) {
+        const auto k     = key(node);
+        const auto start = hash(k);
+        for (std::size_t i = 0U; i < MAX_PROBES; ++i) {
+            const auto index = (start + i) & mask;
+            auto&      slot  = uniqueTable[index];
+            auto       state = slot.state.load(std::memory_order_acquire);
+            if (state == SlotState::Empty) {
+                if (slot.state.compare_exchange_strong(state, SlotState::Writing, std::memory_order_acquire)) {
+                    slot.key  = k;
+                    slot.node = node;
+                    slot.state.store(SlotState::Ready, std::memory_order_release);
+                    return index + 1U;
+                }
+            }
+            // a node that is just being written might be identical. In this case, the node merely ends up with two IDs
+            if (state == SlotState::Ready && slot.key == k) {
+                return index + 1U;
+            }
+        }
+        return std::nullopt;
+    }
+
+    const SharedComputeTable::Node& SharedComputeTable::node(NodeID id) const {
+        if (id == TERMINAL || id > uniqueTable.size()) {
+            throw std::out_of_range("Invalid node ID of the shared compute table.");
+        }
+        return uniqueTable[id - 1U].node;
+    }
+
+    std::optional<SharedComputeTable::Result> SharedComputeTable::lookup(std::uint64_t operation, NodeID node, std::size_t client) {
+        lookups.fetch_add(1U, std::memory_order_relaxed);
+
+        const auto& slot  = computeTable[hash({static_cast<std::int64_t>(operation), static_cast<std::int64_t>(node)}) & mask];
+        const auto  begin = slot.sequence.load(std::memory_order_acquire);
+        if (begin == 0U || begin % 2U == 1U) {
+            return std::nullopt;
+        }
+        const auto entryOperation = slot.operation.load(std::memory_order_relaxed);
+        const auto entryNode      = slot.node.load(std::memory_order_relaxed);
+        const auto result         = Result{slot.result.load(std::memory_order_relaxed),
+                                           {slot.real.load(std::memory_order_relaxed), slot.imag.load(std::memory_order_relaxed)}};
+        const auto provider       = slot.client.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != begin || entryOperation != operation || entryNode != node) {
+            return std::nullopt;
+        }
+
+        hits.fetch_add(1U, std::memory_order_relaxed);
+        if (provider != client) {
+            crossHits.fetch_add(1U, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    void SharedComputeTable::insert(std::uint64_t operation, NodeID node, const Result& result, std::size_t client) {
+        auto& slot  = computeTable[hash({static_cast<std::int64_t>(operation), static_cast<std::int64_t>(node)}) & mask];
+        auto  begin = slot.sequence.load(std::memory_order_relaxed);
+        // the entry is lost if another thread is writing the same slot
+        if (begin % 2U == 1U || !slot.sequence.compare_exchange_strong(begin, begin + 1U, std::memory_order_relaxed)) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.operation.store(operation, std::memory_order_relaxed);
+        slot.node.store(node, std::memory_order_relaxed);
+        slot.result.store(result.node, std::memory_order_relaxed);
+        slot.real.store(result.weight.real(), std::memory_order_relaxed);
+        slot.imag.store(result.weight.imag(), std::memory_order_relaxed);
+        slot.client.store(client, std::memory_order_relaxed);
+        slot.sequence.store(begin + 2U, std::memory_order_release);
+    }
+
+    nlohmann::json SharedComputeTable::json() const {
+        const auto total = getLookups();
+        const auto rate  = [total](std::size_t count) { return total == 0U ? 0. : static_cast<double>(count) / static_cast<double>(total); };
+
+        nlohmann::json j{};
+        j["capacity"]              = mask + 1U;
+        j["lookups"]               = total;
+        j["hits"]                  = getHits();
+        j["hit_rate"]              = rate(getHits());
+        j["cross_thread_hits"]     = getCrossHits();
+        j["cross_thread_hit_rate"] = rate(getCrossHits());
+        return j;
+    }
+
+    SharedComputeTable::Client::Client(std::shared_ptr<SharedComputeTable> table, std::unique_ptr<SimulationDDPackage>& dd):
+        table(std::move(table)), dd(dd), id(this->table->newClient()) {}
+
+    std::optional<SharedComputeTable::NodeID> SharedComputeTable::Client::identify(const qc::VectorDD& state) {
+        if (ids.size() + nodes.size() > MAX_LOCAL_NODES) {
+            clear();
+        }
+        std::size_t budget = MAX_NEW_NODES;
+        return identify(state.p, budget);
+    }
+
+    std::optional<SharedComputeTable::NodeID> SharedComputeTable::Client::identify(dd::vNode* p, std::size_t& budget) {
+        if (dd::vNode::isTerminal(p)) {
+            return TERMINAL;
+        }
+        if (const auto it = ids.find(p); it != ids.end()) {
+            return it->second;
+        }
+        if (budget == 0U) {
+            return std::nullopt;
+        }
+        --budget;
+
+        Node node{p->v, {}, {}};
+        for (std::size_t i = 0U; i < p->e.size(); ++i) {
+            const auto& e = p->e[i];
+            if (e.w.approximatelyZero()) {
+                continue;
+            }
+            const auto child = identify(e.p, budget);
+            if (!child) {
+                return std::nullopt;
+            }
+            node.children[i] = *child;
+            node.weights[i]  = value(e.w);
+        }
+        const auto result = table->intern(node);
+        if (!result) {
+            return std::nullopt;
+        }
+
+        // the node must not be garbage collected as long as its address identifies it
+        dd->incRef(qc::VectorDD{p, dd::Complex::one});
+        ids.emplace(p, *result);
+        return result;
+    }
+
+    qc::VectorDD SharedComputeTable::Client::materialize(NodeID node) {
+        if (node == TERMINAL) {
+            return qc::VectorDD::one;
+        }
+        if (const auto it = nodes.find(node); it != nodes.end()) {
+            return it->second;
+        }
+
+        const auto&                  shared = table->node(node);
+        std::array<qc::VectorDD, 2U> edges{qc::VectorDD::zero, qc::VectorDD::zero};
+        for (std::size_t i = 0U; i < edges.size(); ++i) {
+            if (shared.weights[i] == std::complex<dd::fp>{}) {
+                continue;
+            }
+            const auto child = materialize(shared.children[i]);
+            const auto w     = shared.weights[i] * value(child.w);
+            edges[i]         = {child.p, dd->cn.lookup(w.real(), w.imag())};
+        }
+        const auto result = dd->makeDDNode(shared.v, edges);
+        dd->incRef(result);
+        nodes.emplace(node, result);
+        return result;
+    }
+
+    std::optional<qc::VectorDD> SharedComputeTable::Client::lookup(std::uint64_t operation, NodeID node, const qc::VectorDD& state) {
+        const auto result = table->lookup(operation, node, id);
+        if (!result) {
+            return std::nullopt;
+        }
+        if (result->weight == std::complex<dd::fp>{}) {
+            return qc::VectorDD::zero;
+        }
+        const auto e = materialize(result->node);
+        const auto w = value(state.w) * result->weight * value(e.w);
+        return qc::VectorDD{e.p, dd->cn.lookup(w.real(), w.imag())};
+    }
+
+    void SharedComputeTable::Client::insert(std::uint64_t operation, NodeID node, const qc::VectorDD& state, const qc::VectorDD& result) {
+        if (state.w.approximatelyZero()) {
+            return;
+        }
+        if (result.w.approximatelyZero()) {
+            table->insert(operation, node, {}, id);
+            return;
+        }
+        std::size_t budget = MAX_NEW_NODES;
+        const auto  target = identify(result.p, budget);
+        if (!target) {
+            return;
+        }
+        // the result is shared relative to the weight of the state
+        table->insert(operation, node, {*target, value(result.w) / value(state.w)}, id);
+    }
+
+    void SharedComputeTable::Client::clear() {
+        for (const auto& [p, node]: ids) {
+            dd->decRef(qc::VectorDD{p, dd::Complex::one});
+        }
+        for (const auto& [node, e]: nodes) {
+            dd->decRef(e);
+        }
+        ids.clear();
+        nodes.clear();
+    }
+} // namespace ec
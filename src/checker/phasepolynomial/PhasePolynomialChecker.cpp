@@ -0,0 +1,331 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "checker/phasepolynomial/PhasePolynomialChecker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+namespace ec {
+    namespace {
+        constexpr dd::fp TWO_PI = 2. * dd::PI;
+
+        bool isZero(const std::vector<std::uint64_t>& bits) {
+            return std::all_of(bits.begin(), bits.end(), [](const auto word) { return word == 0U; });
+        }
+
+        // whether `subset` (given as sorted positions) is contained in the support of `bits`
+        bool contains(const std::vector<std::uint64_t>& bits, const std::vector<std::size_t>& subset) {
+            return std::all_of(subset.begin(), subset.end(), [&](const auto i) { return ((bits[i / 64U] >> (i % 64U)) & 1U) != 0U; });
+        }
+    } // namespace
+
+    PhasePolynomialChecker::PhasePolynomialChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration):
+        EquivalenceChecker(qc1, qc2, configuration) {
+        // just as for the simulation checker, the ancillaries are the highest logical qubits
+        ninputs = qc1.getNqubitsWithoutAncillae();
+
+        inputs1.assign(nqubits, -1);
+        inputs2.assign(nqubits, -1);
+        outputs1.assign(nqubits, -1);
+        outputs2.assign(nqubits, -1);
+        const auto locate = [](const qc::Permutation& permutation, std::vector<std::ptrdiff_t>& located) {
+            for (const auto& [physical, logical]: permutation) {
+                located.at(static_cast<std::size_t>(logical)) = static_cast<std::ptrdiff_t>(physical);
+            }
+        };
+        locate(qc1.initialLayout, inputs1);
+        locate(qc2.initialLayout, inputs2);
+        locate(qc1.outputPermutation, outputs1);
+        locate(qc2.outputPermutation, outputs2);
+
+        for (std::size_t q = 0U; q < nqubits; ++q) {
+            const auto logical = static_cast<dd::Qubit>(q);
+            if (outputs1[q] < 0 || outputs2[q] < 0 || qc1.logicalQubitIsGarbage(logical) || qc2.logicalQubitIsGarbage(logical)) {
+                partial = true;
+            }
+        }
+    }
+
+    bool PhasePolynomialChecker::isApplicable(const qc::QuantumComputation& qc) {
+        for (const auto& op: qc) {
+            if (op->getType() == qc::Barrier) {
+                continue;
+            }
+            if (!op->isStandardOperation()) {
+                return false;
+            }
+            switch (op->getType()) {
+                case qc::I:
+                case qc::X:
+                case qc::Z:
+                case qc::S:
+                case qc::Sdag:
+                case qc::T:
+                case qc::Tdag:
+                case qc::Phase:
+                case qc::RZ:
+                    // a phase on the conjunction of more than two variables is not a sum of parities with few terms
+                    if (op->getNtargets() != 1U || op->getNcontrols() > 1U) {
+                        return false;
+                    }
+                    break;
+                case qc::SWAP:
+                    if (op->getNtargets() != 2U || op->getNcontrols() > 0U) {
+                        return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    PhasePolynomialChecker::PhasePolynomial PhasePolynomialChecker::compute(const qc::QuantumComputation& qc, const std::vector<std::ptrdiff_t>& inputs) const {
+        const auto nwords = std::max<std::size_t>(1U, (ninputs + 63U) / 64U);
+
+        // physical qubits need not be contiguous (e.g., after idle qubits have been stripped)
+        std::size_t nwires = 0U;
+        const auto  use    = [&](dd::Qubit physical) { nwires = std::max(nwires, static_cast<std::size_t>(physical) + 1U); };
+        for (const auto& [physical, logical]: qc.initialLayout) {
+            use(physical);
+        }
+        for (const auto& [physical, logical]: qc.outputPermutation) {
+            use(physical);
+        }
+        for (const auto& op: qc) {
+            for (const auto& target: op->getTargets()) {
+                use(target);
+            }
+            for (const auto& control: op->getControls()) {
+                use(control.qubit);
+            }
+        }
+
+        PhasePolynomial poly{};
+        auto&           wires = poly.wires;
+        wires.assign(nwires, Affine{BitVector(nwords, 0U), false});
+        for (std::size_t q = 0U; q < ninputs; ++q) {
+            if (inputs[q] >= 0) {
+                wires.at(static_cast<std::size_t>(inputs[q])).bits[q / 64U] |= Word{1U} << (q % 64U);
+            }
+        }
+
+        // multiply the amplitude by exp(i*angle*f(x))
+        const auto addPhase = [&](const Affine& f, dd::fp angle) {
+            if (f.constant) {
+                // angle*(1 + a.x) = angle - angle*(a.x)
+                poly.globalPhase += angle;
+                angle = -angle;
+            }
+            if (!isZero(f.bits)) {
+                poly.terms[f.bits] += angle;
+            }
+        };
+        const auto sum = [](const Affine& f, const Affine& g) {
+            Affine h{f};
+            for (std::size_t i = 0U; i < h.bits.size(); ++i) {
+                h.bits[i] ^= g.bits[i];
+            }
+            h.constant ^= g.constant;
+            return h;
+        };
+
+        for (const auto& op: qc) {
+            const auto type = op->getType();
+            if (type == qc::Barrier || type == qc::I) {
+                continue;
+            }
+            const auto& targets = op->getTargets();
+            auto&       target  = wires.at(static_cast<std::size_t>(targets[0]));
+
+            if (type == qc::SWAP) {
+                std::swap(target, wires.at(static_cast<std::size_t>(targets[1])));
+                continue;
+            }
+
+            // a negative control corresponds to the complemented function
+            Affine control{};
+            const auto controlled = op->getNcontrols() == 1U;
+            if (controlled) {
+                const auto& c = *op->getControls().begin();
+                control       = wires.at(static_cast<std::size_t>(c.qubit));
+                control.constant ^= (c.type == dd::Control::Type::neg);
+            }
+
+            if (type == qc::X) {
+                if (controlled) {
+                    target = sum(target, control);
+                } else {
+                    target.constant = !target.constant;
+                }
+                continue;
+            }
+
+            dd::fp angle = 0.;
+            dd::fp phase = 0.;
+            switch (type) {
+                case qc::Z: angle = dd::PI; break;
+                case qc::S: angle = dd::PI_2; break;
+                case qc::Sdag: angle = -dd::PI_2; break;
+                case qc::T: angle = dd::PI_4; break;
+                case qc::Tdag: angle = -dd::PI_4; break;
+                case qc::Phase: angle = op->getParameter()[0]; break;
+                case qc::RZ:
+                    // RZ(theta) = exp(-i*theta/2) * Phase(theta)
+                    angle = op->getParameter()[0];
+                    phase = -angle / 2.;
+                    break;
+                default:
+                    throw std::invalid_argument("Operation " + op->getName() + " is not supported by the phase polynomial checker.");
+            }
+
+            if (!controlled) {
+                poly.globalPhase += phase;
+                addPhase(target, angle);
+                continue;
+            }
+            // the phase is applied to the conjunction c*t = (c + t - (c xor t)) / 2 of control and target
+            addPhase(control, phase);
+            addPhase(control, angle / 2.);
+            addPhase(target, angle / 2.);
+            addPhase(sum(control, target), -angle / 2.);
+        }
+        return poly;
+    }
+
+    bool PhasePolynomialChecker::isMultiple(const dd::fp angle, const dd::fp modulus) const {
+        // the angles accumulate rounding errors over all gates. Hence, the tolerance is never chosen tighter than this
+        const auto tolerance = std::max(configuration.execution.numericalTolerance, 1e-10);
+        auto       remainder = std::fmod(angle, modulus);
+        if (remainder < 0.) {
+            remainder += modulus;
+        }
+        return remainder < tolerance || modulus - remainder < tolerance;
+    }
+
+    EquivalenceCriterion PhasePolynomialChecker::comparePhases(const std::map<BitVector, dd::fp>& difference) {
+        // Writing each parity a.x as the multilinear polynomial sum_{S in a, S non-empty} (-2)^{|S|-1} prod_{i in S} x_i shows
+        // that the difference is constant modulo 2*pi if and only if, for all non-empty sets S of inputs, the angles of the
+        // parities containing S sum up to a multiple of 2*pi / 2^{|S|-1}. Parities whose angle already is such a multiple
+        // can be disregarded for all sets of this size. For multiples of pi/4, no parity remains beyond sets of size three.
+        std::vector<std::pair<const BitVector*, dd::fp>> active{};
+        for (const auto& [bits, angle]: difference) {
+            active.emplace_back(&bits, angle);
+        }
+
+        for (std::size_t order = 1U;; ++order) {
+            const auto modulus = TWO_PI / std::pow(2., static_cast<dd::fp>(order - 1U));
+            active.erase(std::remove_if(active.begin(), active.end(), [&](const auto& term) { return isMultiple(term.second, modulus); }), active.end());
+            if (active.empty()) {
+                return EquivalenceCriterion::Equivalent;
+            }
+            // the remaining angles cannot be distinguished from irrational angles that have to cancel exactly
+            if (modulus < 1e3 * std::max(configuration.execution.numericalTolerance, 1e-10)) {
+                return EquivalenceCriterion::NoInformation;
+            }
+
+            // collect all sets of `order` inputs that are contained in at least one of the remaining parities
+            std::set<std::vector<std::size_t>> candidates{};
+            for (const auto& [bits, angle]: active) {
+                std::vector<std::size_t> support{};
+                for (std::size_t i = 0U; i < ninputs; ++i) {
+                    if ((((*bits)[i / 64U] >> (i % 64U)) & 1U) != 0U) {
+                        support.emplace_back(i);
+                    }
+                }
+                if (support.size() < order) {
+                    continue;
+                }
+                // enumerate all subsets of the support of the given size in lexicographical order
+                std::vector<std::size_t> index(order);
+                for (std::size_t i = 0U; i < order; ++i) {
+                    index[i] = i;
+                }
+                while (true) {
+                    std::vector<std::size_t> subset(order);
+                    for (std::size_t i = 0U; i < order; ++i) {
+                        subset[i] = support[index[i]];
+                    }
+                    candidates.emplace(std::move(subset));
+                    if (candidates.size() > MAX_CANDIDATES) {
+                        return EquivalenceCriterion::NoInformation;
+                    }
+
+                    auto i = order;
+                    while (i > 0U && index[i - 1U] == support.size() - order + i - 1U) {
+                        --i;
+                    }
+                    if (i == 0U) {
+                        break;
+                    }
+                    ++index[i - 1U];
+                    for (auto j = i; j < order; ++j) {
+                        index[j] = index[j - 1U] + 1U;
+                    }
+                }
+            }
+
+            for (const auto& subset: candidates) {
+                if (isDone()) {
+                    return EquivalenceCriterion::NoInformation;
+                }
+                dd::fp total = 0.;
+                for (const auto& [bits, angle]: active) {
+                    if (contains(*bits, subset)) {
+                        total += angle;
+                    }
+                }
+                if (!isMultiple(total, modulus)) {
+                    return EquivalenceCriterion::NotEquivalent;
+                }
+            }
+        }
+    }
+
+    EquivalenceCriterion PhasePolynomialChecker::run() {
+        const auto start = std::chrono::steady_clock::now();
+
+        equivalence = EquivalenceCriterion::NoInformation;
+
+        const auto poly1 = compute(qc1, inputs1);
+        const auto poly2 = compute(qc2, inputs2);
+
+        // the affine parts have to coincide for all outputs that are compared
+        bool different = false;
+        for (std::size_t q = 0U; q < nqubits && !different; ++q) {
+            if (outputs1[q] < 0 || outputs2[q] < 0 || qc1.logicalQubitIsGarbage(static_cast<dd::Qubit>(q)) || qc2.logicalQubitIsGarbage(static_cast<dd::Qubit>(q))) {
+                continue;
+            }
+            const auto& f = poly1.wires.at(static_cast<std::size_t>(outputs1[q]));
+            const auto& g = poly2.wires.at(static_cast<std::size_t>(outputs2[q]));
+            different     = f.constant != g.constant || f.bits != g.bits;
+        }
+
+        if (different) {
+            // basis states are mapped to different basis states on some output
+            equivalence = EquivalenceCriterion::NotEquivalent;
+        } else if (!partial) {
+            auto difference = poly1.terms;
+            for (const auto& [bits, angle]: poly2.terms) {
+                difference[bits] -= angle;
+            }
+            parityTerms = difference.size();
+
+            equivalence = comparePhases(difference);
+            if (equivalence == EquivalenceCriterion::Equivalent && !isMultiple(poly1.globalPhase - poly2.globalPhase, TWO_PI)) {
+                equivalence = EquivalenceCriterion::EquivalentUpToGlobalPhase;
+            }
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        runtime += std::chrono::duration<double>(end - start).count();
+        return equivalence;
+    }
+} // namespace ec
@@ -0,0 +1,229 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "checker/reversible/ReversibleChecker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+
+namespace ec {
+    ReversibleChecker::ReversibleChecker(const qc::QuantumComputation& qc1, const qc::QuantumComputation& qc2, const Configuration& configuration):
+        EquivalenceChecker(qc1, qc2, configuration),
+        circuit1(compile(qc1)), circuit2(compile(qc2)) {
+        // just as for the simulation checker, the ancillaries are the highest logical qubits
+        ninputs = qc1.getNqubitsWithoutAncillae();
+
+        for (std::size_t q = 0U; q < nqubits; ++q) {
+            const auto logical = static_cast<dd::Qubit>(q);
+            if (circuit1.outputs[q] < 0 || circuit2.outputs[q] < 0 || qc1.logicalQubitIsGarbage(logical) || qc2.logicalQubitIsGarbage(logical)) {
+                partial = true;
+                continue;
+            }
+            compared.emplace_back(q);
+        }
+    }
+
+    bool ReversibleChecker::isReversible(const qc::QuantumComputation& qc) {
+        for (const auto& op: qc) {
+            if (op->getType() == qc::Barrier) {
+                continue;
+            }
+            if (!op->isStandardOperation()) {
+                return false;
+            }
+            switch (op->getType()) {
+                case qc::I:
+                case qc::X:
+                    if (op->getNtargets() != 1U) {
+                        return false;
+                    }
+                    break;
+                case qc::SWAP:
+                    if (op->getNtargets() != 2U) {
+                        return false;
+                    }
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    ReversibleChecker::Circuit ReversibleChecker::compile(const qc::QuantumComputation& qc) const {
+        Circuit circuit{};
+        circuit.inputs.assign(nqubits, -1);
+        circuit.outputs.assign(nqubits, -1);
+
+        // physical qubits need not be contiguous (e.g., after idle qubits have been stripped)
+        const auto use = [&](dd::Qubit physical) {
+            circuit.nqubits = std::max(circuit.nqubits, static_cast<std::size_t>(physical) + 1U);
+            return static_cast<std::size_t>(physical);
+        };
+        for (const auto& [physical, logical]: qc.initialLayout) {
+            circuit.inputs.at(static_cast<std::size_t>(logical)) = static_cast<std::ptrdiff_t>(use(physical));
+        }
+        for (const auto& [physical, logical]: qc.outputPermutation) {
+            circuit.outputs.at(static_cast<std::size_t>(logical)) = static_cast<std::ptrdiff_t>(use(physical));
+        }
+
+        for (const auto& op: qc) {
+            if (op->getType() == qc::Barrier || op->getType() == qc::I) {
+                continue;
+            }
+            Gate gate{};
+            for (const auto& control: op->getControls()) {
+                gate.controls.emplace_back(use(control.qubit), control.type == dd::Control::Type::pos);
+            }
+            const auto& targets = op->getTargets();
+            gate.target0        = use(targets[0]);
+            if (op->getType() == qc::SWAP) {
+                gate.target1 = static_cast<std::ptrdiff_t>(use(targets[1]));
+            }
+            circuit.gates.emplace_back(std::move(gate));
+        }
+        return circuit;
+    }
+
+    void ReversibleChecker::simulate(const Circuit& circuit, const std::vector<Block>& inputs, std::vector<Block>& state) {
+        state.assign(circuit.nqubits, Block{});
+        for (std::size_t q = 0U; q < inputs.size(); ++q) {
+            if (circuit.inputs[q] >= 0) {
+                state[static_cast<std::size_t>(circuit.inputs[q])] = inputs[q];
+            }
+        }
+
+        for (const auto& gate: circuit.gates) {
+            // the inputs for which all controls are satisfied
+            Block mask{};
+            mask.fill(~Word{0U});
+            for (const auto& [qubit, positive]: gate.controls) {
+                const auto& control = state[qubit];
+                for (std::size_t k = 0U; k < LANES; ++k) {
+                    mask[k] &= positive ? control[k] : ~control[k];
+                }
+            }
+
+            auto& target0 = state[gate.target0];
+            if (gate.target1 < 0) {
+                for (std::size_t k = 0U; k < LANES; ++k) {
+                    target0[k] ^= mask[k];
+                }
+            } else {
+                auto& target1 = state[static_cast<std::size_t>(gate.target1)];
+                for (std::size_t k = 0U; k < LANES; ++k) {
+                    const auto diff = (target0[k] ^ target1[k]) & mask[k];
+                    target0[k] ^= diff;
+                    target1[k] ^= diff;
+                }
+            }
+        }
+    }
+
+    ReversibleChecker::Block ReversibleChecker::exhaustiveInput(std::size_t input, std::size_t block) {
+        // the bits of each word enumerate the values of the six lowest inputs
+        static constexpr std::array<Word, 6U> PATTERNS{0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+                                                       0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+        Block result{};
+        for (std::size_t k = 0U; k < LANES; ++k) {
+            if (input < PATTERNS.size()) {
+                result[k] = PATTERNS[input];
+            } else {
+                // the remaining inputs are determined by the index of the word
+                const auto word = block * LANES + k;
+                result[k]       = ((word >> (input - PATTERNS.size())) & 1U) != 0U ? ~Word{0U} : Word{0U};
+            }
+        }
+        return result;
+    }
+
+    bool ReversibleChecker::compare(const std::vector<Block>& inputs, std::vector<Block>& state1, std::vector<Block>& state2) {
+        simulate(circuit1, inputs, state1);
+        simulate(circuit2, inputs, state2);
+
+        for (const auto q: compared) {
+            const auto& out1 = state1[static_cast<std::size_t>(circuit1.outputs[q])];
+            const auto& out2 = state2[static_cast<std::size_t>(circuit2.outputs[q])];
+            for (std::size_t k = 0U; k < LANES; ++k) {
+                const auto diff = out1[k] ^ out2[k];
+                if (diff == 0U) {
+                    continue;
+                }
+                std::size_t bit = 0U;
+                while (((diff >> bit) & 1U) == 0U) {
+                    ++bit;
+                }
+                counterexample.assign(nqubits, '0');
+                for (std::size_t i = 0U; i < nqubits; ++i) {
+                    if (((inputs[i][k] >> bit) & 1U) != 0U) {
+                        counterexample[nqubits - 1U - i] = '1';
+                    }
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    EquivalenceCriterion ReversibleChecker::run() {
+        const auto start = std::chrono::steady_clock::now();
+
+        equivalence    = EquivalenceCriterion::NoInformation;
+        checkedStimuli = 0U;
+        counterexample.clear();
+
+        std::vector<Block> inputs(nqubits, Block{});
+        std::vector<Block> state1{};
+        std::vector<Block> state2{};
+
+        const auto maxExhaustiveInputs = std::min<std::size_t>(configuration.reversible.maxExhaustiveInputs, 62U);
+        exhaustive                     = ninputs <= maxExhaustiveInputs;
+
+        std::size_t     nblocks  = 0U;
+        std::size_t     perBlock = WIDTH;
+        std::mt19937_64 mt{};
+        if (exhaustive) {
+            const auto nstimuli = std::size_t{1U} << ninputs;
+            nblocks             = std::max<std::size_t>(1U, nstimuli / WIDTH);
+            perBlock            = std::min(nstimuli, WIDTH);
+        } else {
+            nblocks = std::max<std::size_t>(1U, (configuration.reversible.nRandomStimuli + WIDTH - 1U) / WIDTH);
+            if (configuration.simulation.seed == 0U) {
+                mt.seed(std::random_device{}());
+            } else {
+                mt.seed(configuration.simulation.seed);
+            }
+        }
+
+        bool        different = false;
+        std::size_t block     = 0U;
+        for (; block < nblocks && !isDone(); ++block) {
+            for (std::size_t q = 0U; q < ninputs; ++q) {
+                if (exhaustive) {
+                    inputs[q] = exhaustiveInput(q, block);
+                } else {
+                    std::generate(inputs[q].begin(), inputs[q].end(), std::ref(mt));
+                }
+            }
+            if (!compare(inputs, state1, state2)) {
+                different = true;
+                break;
+            }
+            checkedStimuli += perBlock;
+        }
+
+        if (different) {
+            equivalence = EquivalenceCriterion::NotEquivalent;
+        } else if (block == nblocks) {
+            equivalence = (exhaustive && !partial) ? EquivalenceCriterion::Equivalent : EquivalenceCriterion::ProbablyEquivalent;
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        runtime += std::chrono::duration<double>(end - start).count();
+        return equivalence;
+    }
+} // namespace ec
@@ -0,0 +1,61 @@
+import pytest
+
+from mqt import qcec
+from qiskit import QuantumCircuit
+from qiskit.circuit import Parameter
+
+
+@pytest.fixture
+def theta():
+    return Parameter("theta")
+
+
+def test_symbolic_cancellation(theta):
+    """Test that circuits with the same parameterized gates are shown equivalent symbolically"""
+    qc1 = QuantumCircuit(2)
+    qc1.h(0)
+    qc1.rz(theta, 0)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumCircuit(2)
+    qc2.h(0)
+    qc2.rz(theta / 2, 0)
+    qc2.rz(theta / 2, 0)
+    qc2.cx(0, 1)
+
+    ecm = qcec.EquivalenceCheckingManager(qc1, qc2)
+    ecm.run()
+    assert ecm.equivalence() == qcec.EquivalenceCriterion.equivalent
+    assert ecm.get_results().performed_instantiations == 1
+
+
+def test_random_instantiations(theta):
+    """Test that the configured number of instantiations is checked if no symbolic conclusion is possible"""
+    qc1 = QuantumCircuit(2)
+    qc1.p(theta, 0)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumCircuit(2)
+    qc2.cx(0, 1)
+    qc2.p(theta, 0)
+
+    config = qcec.Configuration()
+    config.optimizations.reorder_operations = False
+    config.parameterized.n_instantiations = 4
+    ecm = qcec.EquivalenceCheckingManager(qc1, qc2, config)
+    ecm.run()
+    assert ecm.equivalence() == qcec.EquivalenceCriterion.probably_equivalent
+    assert ecm.get_results().performed_instantiations == 4
+
+
+def test_not_equivalent(theta):
+    """Test that differing parameterized gates are detected"""
+    qc1 = QuantumCircuit(1)
+    qc1.ry(theta, 0)
+
+    qc2 = QuantumCircuit(1)
+    qc2.ry(2 * theta, 0)
+
+    ecm = qcec.EquivalenceCheckingManager(qc1, qc2)
+    ecm.run()
+    assert ecm.equivalence() == qcec.EquivalenceCriterion.not_equivalent
@@ -0,0 +1,161 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "ConfigurationSweep.hpp"
+#include "ToleranceScope.hpp"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ConfigurationSweepTest: public testing::Test {
+    void SetUp() override {
+        qc1.import("./circuits/test/test.real");
+        qc2.import("./circuits/test/test_alternative.real");
+    }
+
+protected:
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+};
+
+TEST_F(ConfigurationSweepTest, SchemesAndStateTypes) {
+    std::vector<ec::Configuration> configurations{};
+    for (const auto scheme: {ec::ApplicationSchemeType::Proportional, ec::ApplicationSchemeType::OneToOne, ec::ApplicationSchemeType::Lookahead}) {
+        for (const auto stateType: {ec::StateType::ComputationalBasis, ec::StateType::Random1QBasis}) {
+            auto& config                         = configurations.emplace_back();
+            config.execution.parallel            = false;
+            config.application.alternatingScheme = scheme;
+            config.simulation.stateType          = stateType;
+        }
+    }
+    // a different preprocessing setting
+    configurations.emplace_back().optimizations.reorderOperations = false;
+    // a configuration that cannot be run
+    configurations.emplace_back().partialEquivalence.relevantOutputs = {64};
+
+    ec::ConfigurationSweep sweep(qc1, qc2, configurations);
+    sweep.run();
+    std::cout << sweep << std::endl;
+
+    const auto& entries = sweep.getEntries();
+    ASSERT_EQ(entries.size(), configurations.size());
+    for (std::size_t i = 0U; i + 1U < entries.size(); ++i) {
+        EXPECT_TRUE(entries[i].error.empty());
+        EXPECT_EQ(entries[i].equivalence, ec::EquivalenceCriterion::Equivalent);
+    }
+    EXPECT_FALSE(entries.back().error.empty());
+
+    // all configurations with the same preprocessing setting share the preprocessing
+    EXPECT_EQ(entries.front().preprocessingTime, entries[1].preprocessingTime);
+
+    const auto best = sweep.best();
+    ASSERT_TRUE(best.has_value());
+    EXPECT_TRUE(entries[*best].conclusive());
+    EXPECT_EQ(sweep.json().at("best"), *best);
+}
+
+TEST_F(ConfigurationSweepTest, DifferentTolerances) {
+    const auto                     defaultTolerance = dd::ComplexTable<>::tolerance();
+    std::vector<ec::Configuration> configurations{};
+    for (const auto tolerance: {1e-10, defaultTolerance, 1e-12, 1e-10, defaultTolerance}) {
+        auto& config                        = configurations.emplace_back();
+        config.execution.parallel           = false;
+        config.execution.numericalTolerance = tolerance;
+    }
+
+    ec::ConfigurationSweep sweep(qc1, qc2, configurations);
+    sweep.run();
+    for (const auto& entry: sweep.getEntries()) {
+        EXPECT_TRUE(entry.error.empty());
+        EXPECT_EQ(entry.equivalence, ec::EquivalenceCriterion::Equivalent);
+    }
+
+    dd::ComplexTable<>::setTolerance(defaultTolerance);
+}
+
+TEST(ToleranceScopeTest, ScopesWithDifferentTolerancesDoNotOverlap) {
+    const auto        defaultTolerance = dd::ComplexTable<>::tolerance();
+    std::atomic<bool> mismatch{false};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0U; t < 8U; ++t) {
+        threads.emplace_back([&, t] {
+            const auto tolerance = (t % 2U == 0U) ? 1e-10 : 1e-12;
+            for (std::size_t i = 0U; i < 100U; ++i) {
+                const ec::ToleranceScope scope(tolerance);
+                if (dd::ComplexTable<>::tolerance() != tolerance) {
+                    mismatch = true;
+                }
+                std::this_thread::yield();
+                if (dd::ComplexTable<>::tolerance() != tolerance) {
+                    mismatch = true;
+                }
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(mismatch);
+
+    dd::ComplexTable<>::setTolerance(defaultTolerance);
+}
+
+TEST(ToleranceScopeTest, WaitingScopesAreNotOvertaken) {
+    const auto defaultTolerance = dd::ComplexTable<>::tolerance();
+
+    std::vector<std::size_t> order{};
+    std::mutex               mutex{};
+    auto                     first = std::make_unique<ec::ToleranceScope>(1e-10);
+
+    // a scope with a different tolerance has to wait for the first one
+    std::thread different([&] {
+        const ec::ToleranceScope scope(1e-12);
+        const std::lock_guard    lock(mutex);
+        order.emplace_back(1U);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // a scope with the same tolerance as the active one arrives later and must not overtake the waiting one
+    std::thread same([&] {
+        const ec::ToleranceScope scope(1e-10);
+        const std::lock_guard    lock(mutex);
+        order.emplace_back(2U);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        const std::lock_guard lock(mutex);
+        EXPECT_TRUE(order.empty());
+    }
+
+    first.reset();
+    different.join();
+    same.join();
+    EXPECT_EQ(order, (std::vector<std::size_t>{1U, 2U}));
+
+    dd::ComplexTable<>::setTolerance(defaultTolerance);
+}
+
+TEST(ToleranceScopeTest, WaitingIsBoundedByTheDeadline) {
+    const auto defaultTolerance = dd::ComplexTable<>::tolerance();
+    {
+        const ec::ToleranceScope active(1e-10);
+        const ec::ToleranceScope waiting(1e-12, std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+        EXPECT_FALSE(waiting.acquired());
+        EXPECT_EQ(dd::ComplexTable<>::tolerance(), 1e-10);
+    }
+
+    // the scope that gave up does not block the following ones
+    const ec::ToleranceScope next(1e-12, std::chrono::steady_clock::now() + std::chrono::seconds(10));
+    EXPECT_TRUE(next.acquired());
+    EXPECT_EQ(dd::ComplexTable<>::tolerance(), 1e-12);
+
+    dd::ComplexTable<>::setTolerance(defaultTolerance);
+}
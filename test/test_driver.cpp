@@ -0,0 +1,108 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Driver.hpp"
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+class DriverTest: public testing::Test {
+    void SetUp() override {
+        root = fs::temp_directory_path() / ("qcec_driver_" + std::to_string(std::hash<std::string>{}(testing::UnitTest::GetInstance()->current_test_info()->name())));
+        fs::remove_all(root);
+        fs::create_directories(root);
+    }
+
+    void TearDown() override {
+        fs::remove_all(root);
+    }
+
+protected:
+    fs::path root{};
+
+    fs::path write(const std::string& file, const std::string& content) const {
+        std::ofstream ofs(root / file);
+        ofs << content;
+        return root / file;
+    }
+};
+
+TEST_F(DriverTest, ManifestParsing) {
+    std::istringstream iss("# header comment\n"
+                           "\n"
+                           "a.qasm b.qasm\n"
+                           "   \t  \n"
+                           "  c.real\t d.real  \n"
+                           "#e.qasm f.qasm\n");
+    const auto         pairs = ec::readManifest(iss, "manifest");
+    ASSERT_EQ(pairs.size(), 2U);
+    EXPECT_EQ(pairs[0].index, 0U);
+    EXPECT_EQ(pairs[0].file1, "a.qasm");
+    EXPECT_EQ(pairs[0].file2, "b.qasm");
+    EXPECT_EQ(pairs[1].index, 1U);
+    EXPECT_EQ(pairs[1].file1, "c.real");
+    EXPECT_EQ(pairs[1].file2, "d.real");
+
+    // the same manifest read from a file
+    const auto file = write("manifest.txt", iss.str());
+    EXPECT_EQ(ec::readManifest(file.string()).size(), 2U);
+}
+
+TEST_F(DriverTest, MalformedManifest) {
+    for (const auto* const content: {"a.qasm b.qasm\nc.qasm\n", "a.qasm b.qasm\nc.qasm d.qasm e.qasm\n"}) {
+        std::istringstream iss(content);
+        try {
+            const auto pairs = ec::readManifest(iss, "manifest");
+            FAIL() << "Malformed manifest has been accepted: " << content;
+        } catch (const std::runtime_error& e) {
+            // the error refers to the offending line
+            EXPECT_NE(std::string(e.what()).find("line 2"), std::string::npos) << e.what();
+        }
+    }
+
+    EXPECT_THROW(const auto pairs = ec::readManifest((root / "missing.txt").string()), std::runtime_error);
+}
+
+TEST_F(DriverTest, ResultFormatting) {
+    auto qc1 = qc::QuantumComputation(2U);
+    qc1.x(0);
+    qc1.x(0);
+    auto qc2 = qc::QuantumComputation(2U);
+    qc2.z(1);
+    qc2.z(1);
+
+    ec::Configuration config{};
+    config.execution.parallel = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+
+    const ec::CircuitPair pair{3U, "first.qasm", "second.qasm"};
+    const auto            j = ec::formatResult(pair, 0.5, ecm.json());
+    EXPECT_FALSE(j.contains("error"));
+    EXPECT_EQ(j["results"]["equivalence"], "equivalent");
+    EXPECT_EQ(j["pair"]["index"], 3U);
+    EXPECT_EQ(j["pair"]["circuit1"], "first.qasm");
+    EXPECT_EQ(j["pair"]["circuit2"], "second.qasm");
+    EXPECT_DOUBLE_EQ(j["pair"]["load_time"].get<double>(), 0.5);
+
+    // each result is written as a single line that can be parsed on its own
+    const auto line = j.dump();
+    EXPECT_EQ(line.find('\n'), std::string::npos);
+    EXPECT_EQ(nlohmann::json::parse(line), j);
+}
+
+TEST_F(DriverTest, ErrorFormatting) {
+    const ec::CircuitPair pair{0U, "first.qasm", "missing.qasm"};
+    const auto            j = ec::formatResult(pair, 0.25, nlohmann::json{}, "Failed to load circuits: missing.qasm");
+    EXPECT_EQ(j["error"], "Failed to load circuits: missing.qasm");
+    EXPECT_FALSE(j.contains("results"));
+    EXPECT_EQ(j["pair"]["circuit2"], "missing.qasm");
+    EXPECT_DOUBLE_EQ(j["pair"]["load_time"].get<double>(), 0.25);
+}
@@ -0,0 +1,151 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+#include "algorithms/BernsteinVazirani.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace dd::literals;
+
+class DynamicCircuitTest: public testing::Test {
+    void SetUp() override {
+        qc1 = qc::QuantumComputation(nqubits);
+        qc1.addClassicalRegister(nqubits);
+        qc2 = qc::QuantumComputation(nqubits);
+        qc2.addClassicalRegister(nqubits);
+
+        config.execution.runDynamicCircuitChecker = true;
+        config.simulation.seed                    = 12345U;
+    }
+
+protected:
+    dd::QubitCount         nqubits = 3U;
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+};
+
+TEST_F(DynamicCircuitTest, BernsteinVazirani) {
+    auto s   = qc::BitString(15U);
+    auto dbv = qc::BernsteinVazirani(s, true);
+
+    ec::EquivalenceCheckingManager ecm(dbv, dbv, config);
+    EXPECT_TRUE(ecm.isDynamic());
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, RepeatedSyndromeExtraction) {
+    // the syndrome qubit is either reset or conditionally flipped back after each measurement
+    for (std::size_t round = 0U; round < nqubits; ++round) {
+        qc1.x(2, 0_pc);
+        qc1.x(2, 1_pc);
+        qc1.measure(2, round);
+        qc1.reset(2);
+
+        qc2.x(2, 0_pc);
+        qc2.x(2, 1_pc);
+        qc2.measure(2, round);
+        qc2.classicControlled(qc::X, 2, {round, 1U}, 1U);
+    }
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, DeferredMeasurement) {
+    // a measurement followed by a classically-controlled operation is equivalent to a controlled operation followed by a measurement
+    qc1.h(0);
+    qc1.measure(0, 0U);
+    qc1.classicControlled(qc::X, 1, {0U, 1U}, 1U);
+
+    qc2.h(0);
+    qc2.x(1, 0_pc);
+    qc2.measure(0, 0U);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, NotEquivalent) {
+    for (std::size_t round = 0U; round < nqubits; ++round) {
+        qc1.x(2, 0_pc);
+        qc1.x(2, 1_pc);
+        qc1.measure(2, round);
+        qc1.reset(2);
+
+        qc2.x(2, 0_pc);
+        if (round != 1U) {
+            qc2.x(2, 1_pc);
+        }
+        qc2.measure(2, round);
+        qc2.reset(2);
+    }
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, TracedOutQubitsDoNotInterfere) {
+    // the circuits only differ by a phase on a garbage qubit. The reduced state of the remaining qubits is the same
+    // in both cases, even though the amplitudes of both basis values of the garbage qubit add up differently
+    qc1.measure(0, 0U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.setLogicalQubitGarbage(0);
+
+    qc2.measure(0, 0U);
+    qc2.h(0);
+    qc2.z(0);
+    qc2.x(1, 0_pc);
+    qc2.setLogicalQubitGarbage(0);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, GateAfterMeasurement) {
+    // a measured qubit that is acted upon afterwards is still part of the output
+    qc1.h(0);
+    qc1.measure(0, 0U);
+
+    qc2.h(0);
+    qc2.measure(0, 0U);
+    qc2.x(0);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(DynamicCircuitTest, MeasuredQubitMovedBySwap) {
+    // after the SWAP, the measured state belongs to the second output while the first output is acted upon
+    qc1.h(0);
+    qc1.measure(0, 0U);
+    qc1.swap(0, 1);
+    qc1.h(0);
+
+    qc2.h(0);
+    qc2.measure(0, 0U);
+    qc2.swap(0, 1);
+    qc2.h(0);
+    qc2.z(0);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
@@ -4,9 +4,12 @@
 */
 
 #include "EquivalenceCheckingManager.hpp"
+#include "checker/dd/LevelPermutation.hpp"
 #include "checker/dd/applicationscheme/GateCostApplicationScheme.hpp"
+#include "dd/Simulation.hpp"
 
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <functional>
 #include <sstream>
 #include <string>
@@ -111,3 +114,719 @@ TEST_F(EqualityTest, CloseButNotEqualSimulation) {
     std::cout << ecm << std::endl;
     EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
 }
+
+TEST_F(EqualityTest, InferOutputPermutation) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.x(2, 1_pc);
+    qc1.t(2);
+
+    // the outputs of the second circuit are permuted without this being reflected in its output permutation
+    qc2 = qc1.clone();
+    qc2.swap(0, 2);
+
+    config.execution.runAlternatingChecker = true;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+    config.optimizations.fixOutputPermutationMismatch = true;
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, InferOutputPermutationWithGarbage) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.t(1);
+    qc1.x(2, 1_pc);
+    qc1.setLogicalQubitGarbage(2);
+
+    // the first two outputs are permuted and the garbage output is in a different state
+    qc2 = qc1.clone();
+    qc2.swap(0, 1);
+    qc2.h(2);
+
+    config.execution.runAlternatingChecker = true;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_FALSE(ecm.getResults().consideredEquivalent());
+
+    config.optimizations.fixOutputPermutationMismatch = true;
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_TRUE(ecm2.getResults().consideredEquivalent());
+}
+
+TEST_F(EqualityTest, InferOutputPermutationWithAncillae) {
+    qc1 = qc::QuantumComputation(2U);
+    qc1.x(1, 0_pc);
+
+    // the CNOT is computed via an ancillary qubit and the outputs are permuted
+    qc2 = qc::QuantumComputation(3U);
+    qc2.x(2, 0_pc);
+    qc2.x(1, 2_pc);
+    qc2.x(2, 0_pc);
+    qc2.swap(0, 1);
+    qc2.setLogicalQubitAncillary(2);
+    qc2.setLogicalQubitGarbage(2);
+
+    config.execution.runAlternatingChecker = true;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+    config.optimizations.fixOutputPermutationMismatch = true;
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, SwapsAsPermutation) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.swap(0, 1);
+    qc1.x(1, 0_pc);
+    qc1.swap(1, 2);
+    qc1.swap(1, 2, {0_pc});
+    qc1.t(2);
+
+    // conjugating the gates with the preceding SWAPs yields an equivalent circuit
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.x(0, 1_pc);
+    qc2.swap(0, 2, {1_pc});
+    qc2.t(0);
+    qc2.swap(0, 1);
+    qc2.swap(1, 2);
+
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = true;
+    config.execution.runSimulationChecker   = true;
+    config.execution.parallel               = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, SwappedGatesDoNotCancel) {
+    // both X gates act on q0, but on different levels due to the preceding SWAP in the first circuit
+    qc1 = qc::QuantumComputation(2U);
+    qc1.swap(0, 1);
+    qc1.x(0);
+
+    qc2 = qc::QuantumComputation(2U);
+    qc2.x(0);
+    qc2.swap(0, 1);
+
+    ec::DDAlternatingChecker alternating(qc1, qc2, config);
+    EXPECT_EQ(alternating.run(), ec::EquivalenceCriterion::NotEquivalent);
+
+    config.execution.runAlternatingChecker = true;
+    config.execution.runSimulationChecker  = true;
+    config.execution.parallel              = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, OutputPermutationReconciliation) {
+    // a cyclic shift of the qubits realized by SWAP gates
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.t(2);
+    qc1.swap(0, 1);
+    qc1.swap(1, 2);
+
+    // the same cyclic shift expressed by the output permutation
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.x(1, 0_pc);
+    qc2.t(2);
+    qc2.outputPermutation[0] = 2;
+    qc2.outputPermutation[1] = 0;
+    qc2.outputPermutation[2] = 1;
+
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = true;
+    config.execution.runSimulationChecker   = true;
+    config.execution.parallel               = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    // exchanging two of the outputs breaks the equivalence
+    qc2.outputPermutation[1] = 1;
+    qc2.outputPermutation[2] = 0;
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, ReversedLevelPermutation) {
+    // reversing all levels is the worst case for exchanging adjacent levels. Compare with the SWAP-based reference
+    nqubits = 5U;
+    qc1     = qc::QuantumComputation(nqubits);
+    for (dd::QubitCount i = 0U; i < nqubits; ++i) {
+        qc1.h(static_cast<dd::Qubit>(i));
+        qc1.t(static_cast<dd::Qubit>(i));
+    }
+    for (dd::QubitCount i = 1U; i < nqubits; ++i) {
+        qc1.x(static_cast<dd::Qubit>(i), dd::Control{static_cast<dd::Qubit>(i - 1U)});
+        qc1.rz(0.1 * static_cast<dd::fp>(i), static_cast<dd::Qubit>(i));
+    }
+    qc1.ry(0.3, 0);
+
+    qc::Permutation identity{};
+    qc::Permutation reversed{};
+    for (dd::QubitCount i = 0U; i < nqubits; ++i) {
+        identity[static_cast<dd::Qubit>(i)] = static_cast<dd::Qubit>(i);
+        reversed[static_cast<dd::Qubit>(i)] = static_cast<dd::Qubit>(nqubits - 1U - i);
+    }
+
+    auto dd = std::make_unique<dd::Package<>>(nqubits);
+
+    auto state = dd::simulate(&qc1, dd->makeZeroState(nqubits), dd);
+    dd->incRef(state);
+    auto expectedState = state;
+    auto from          = identity;
+    dd::changePermutation(expectedState, from, reversed, dd);
+    from = identity;
+    ec::changePermutation(state, from, reversed, dd);
+    EXPECT_EQ(from, reversed);
+    const auto vector         = dd->getVector(state);
+    const auto expectedVector = dd->getVector(expectedState);
+    for (std::size_t i = 0U; i < vector.size(); ++i) {
+        EXPECT_NEAR(std::abs(vector[i] - expectedVector[i]), 0., 1e-10);
+    }
+
+    auto functionality = dd->makeIdent(nqubits);
+    for (const auto& op: qc1) {
+        functionality = dd->multiply(dd::getDD(op.get(), dd), functionality);
+    }
+    dd->incRef(functionality);
+    for (const bool regular: {true, false}) {
+        auto result   = functionality;
+        auto expected = functionality;
+        dd->incRef(result);
+        dd->incRef(expected);
+        from = identity;
+        dd::changePermutation(expected, from, reversed, dd, regular);
+        from = identity;
+        ec::changePermutation(result, from, reversed, dd, regular);
+        for (std::size_t i = 0U; i < (1ULL << nqubits); ++i) {
+            for (std::size_t j = 0U; j < (1ULL << nqubits); ++j) {
+                const auto value         = dd->getValueByPath(result, i, j);
+                const auto expectedValue = dd->getValueByPath(expected, i, j);
+                EXPECT_NEAR(value.r, expectedValue.r, 1e-10);
+                EXPECT_NEAR(value.i, expectedValue.i, 1e-10);
+            }
+        }
+    }
+}
+
+TEST_F(EqualityTest, ControlledGatesAboveAndBelowTarget) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(1);
+    qc1.x(1, {0_nc, 2_pc});
+    qc1.s(0, {2_pc});
+    qc1.h(2, {1_pc});
+    qc1.t(1, {0_pc});
+
+    // a negative control corresponds to a positive control conjugated by X gates
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(1);
+    qc2.x(0);
+    qc2.x(1, {0_pc, 2_pc});
+    qc2.x(0);
+    qc2.s(0, {2_pc});
+    qc2.h(2, {1_pc});
+    qc2.t(1, {0_pc});
+
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = true;
+    config.execution.runSimulationChecker   = true;
+    config.execution.parallel               = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    qc2.sdag(0, {2_pc});
+    qc2.sdag(0, {2_pc});
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_EQ(ecm2.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, ControlledPhaseGatesAreSymmetric) {
+    // controlled phase gates only apply a phase if all involved qubits are |1>. Hence, the target may be exchanged with any control
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.h(1);
+    qc1.h(2);
+    qc1.t(2, {0_pc});
+    qc1.z(1, {0_pc, 2_pc});
+    qc1.s(0, {1_pc});
+    qc1.tdag(2, {1_pc});
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.h(1);
+    qc2.h(2);
+    qc2.t(0, {2_pc});
+    qc2.z(0, {1_pc, 2_pc});
+    qc2.s(1, {0_pc});
+    qc2.tdag(1, {2_pc});
+
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = true;
+    config.execution.runSimulationChecker   = true;
+    config.execution.parallel               = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, ConcurrentSimulation) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.x(2, 1_pc);
+    qc1.t(2);
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.x(2, 1_pc);
+    qc2.x(1, 0_pc);
+    qc2.x(2, 0_pc);
+    qc2.t(2);
+
+    config.simulation.concurrent = true;
+    config.simulation.stateType  = ec::StateType::ComputationalBasis;
+    config.simulation.seed       = 12345U;
+
+    ec::StateGenerator      generator(config.simulation.seed);
+    ec::DDSimulationChecker checker(qc1, qc2, config);
+    for (auto i = 0U; i < 4U; ++i) {
+        checker.setRandomInitialState(generator);
+        EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+
+        // the states are computed in separate packages, but represent the same vector
+        const auto v1 = checker.getInternalVector1();
+        const auto v2 = checker.getInternalVector2();
+        ASSERT_EQ(v1.size(), v2.size());
+        for (std::size_t j = 0U; j < v1.size(); ++j) {
+            EXPECT_NEAR(std::abs(v1[j] - v2[j]), 0., 1e-8);
+        }
+    }
+
+    // a differing relative phase is detected across both packages
+    qc2.t(2);
+    ec::DDSimulationChecker differing(qc1, qc2, config);
+    differing.setRandomInitialState(generator);
+    EXPECT_EQ(differing.run(), ec::EquivalenceCriterion::NotEquivalent);
+
+    config.execution.runSimulationChecker = true;
+    config.execution.parallel             = false;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, ConcurrentSimulationPropagatesExceptions) {
+    qc1 = qc::QuantumComputation(2U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+
+    // the second circuit is simulated on a separate thread, where no decision diagram exists for the reset
+    qc2 = qc::QuantumComputation(2U);
+    qc2.h(0);
+    qc2.reset(1);
+    qc2.x(1, 0_pc);
+
+    config.simulation.concurrent = true;
+    config.simulation.seed       = 12345U;
+
+    ec::StateGenerator      generator(config.simulation.seed);
+    ec::DDSimulationChecker checker(qc1, qc2, config);
+    checker.setRandomInitialState(generator);
+    EXPECT_ANY_THROW(static_cast<void>(checker.run()));
+}
+
+namespace {
+    // forces a garbage collection right before the final comparison of an inverse simulation
+    class CollectingSimulationChecker: public ec::DDSimulationChecker {
+    public:
+        using ec::DDSimulationChecker::DDSimulationChecker;
+
+        // the references to the initial state after the garbage collection
+        std::size_t initialReferences = 0U;
+
+    protected:
+        void postprocessTask(ec::TaskManager<qc::VectorDD, ec::SimulationDDPackage>& task) override {
+            ec::DDSimulationChecker::postprocessTask(task);
+            dd->garbageCollect(true);
+            initialReferences = initialState.p->ref;
+        }
+    };
+} // namespace
+
+TEST_F(EqualityTest, InverseSimulationKeepsInitialState) {
+    qc1 = qc::QuantumComputation(8U);
+    qc2 = qc::QuantumComputation(8U);
+    for (dd::Qubit q = 0; q < 8; ++q) {
+        qc1.h(q);
+        qc1.t(q);
+        qc2.h(q);
+        qc2.t(q);
+    }
+    for (dd::Qubit q = 1; q < 8; ++q) {
+        qc1.x(q, dd::Control{static_cast<dd::Qubit>(q - 1)});
+        qc2.x(q, dd::Control{static_cast<dd::Qubit>(q - 1)});
+    }
+
+    config.simulation.inverse   = true;
+    config.simulation.seed      = 12345U;
+    config.simulation.stateType = ec::StateType::Random1QBasis;
+    ec::StateGenerator          generator(config.simulation.seed);
+    CollectingSimulationChecker checker(qc1, qc2, config);
+    for (auto i = 0U; i < 4U; ++i) {
+        checker.setRandomInitialState(generator);
+        const auto initial = checker.getInitialVector();
+        EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+
+        // the initial state survives garbage collections during the run
+        EXPECT_GT(checker.initialReferences, 0U);
+        const auto after = checker.getInitialVector();
+        ASSERT_EQ(initial.size(), after.size());
+        for (std::size_t j = 0U; j < initial.size(); ++j) {
+            EXPECT_NEAR(std::abs(initial[j] - after[j]), 0., 1e-8);
+        }
+    }
+}
+
+TEST_F(EqualityTest, InverseSimulation) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.swap(1, 2);
+    qc1.t(1);
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.swap(1, 2);
+    qc2.h(0);
+    qc2.x(2, 0_pc);
+    qc2.t(1);
+
+    // applies the phase to a qubit in superposition
+    auto qc3 = qc::QuantumComputation(3U);
+    qc3.swap(1, 2);
+    qc3.h(0);
+    qc3.x(2, 0_pc);
+    qc3.t(2);
+
+    config.simulation.inverse = true;
+    config.simulation.seed    = 12345U;
+    for (const auto stateType: {ec::StateType::ComputationalBasis, ec::StateType::Random1QBasis, ec::StateType::Stabilizer}) {
+        config.simulation.stateType = stateType;
+        ec::StateGenerator      generator(config.simulation.seed);
+        ec::DDSimulationChecker checker(qc1, qc2, config);
+        ec::DDSimulationChecker differing(qc1, qc3, config);
+        for (auto i = 0U; i < 4U; ++i) {
+            checker.setRandomInitialState(generator);
+            EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+
+            // the result of the inverse simulation matches the initial state
+            const auto v1 = checker.getInternalVector1();
+            const auto v2 = checker.getInitialVector();
+            ASSERT_EQ(v1.size(), v2.size());
+            for (std::size_t j = 0U; j < v1.size(); ++j) {
+                EXPECT_NEAR(std::abs(v1[j] - v2[j]), 0., 1e-8);
+            }
+        }
+        if (stateType == ec::StateType::ComputationalBasis) {
+            differing.setRandomInitialState(generator);
+            EXPECT_EQ(differing.run(), ec::EquivalenceCriterion::NotEquivalent);
+        }
+    }
+
+    config.execution.runSimulationChecker = true;
+    config.execution.parallel             = false;
+    config.simulation.stateType           = ec::StateType::ComputationalBasis;
+    ec::EquivalenceCheckingManager ecm(qc1, qc3, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, ReleasedCheckersKeepStatistics) {
+    qc1.h(0);
+    qc2.h(0);
+
+    config.execution.runSimulationChecker  = true;
+    config.execution.runAlternatingChecker = true;
+    config.execution.parallel              = false;
+    config.simulation.maxSims              = 2U;
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+    for (const auto& checker: ecm.getCheckers()) {
+        EXPECT_EQ(checker, nullptr);
+    }
+
+    const auto j = ecm.json();
+    ASSERT_EQ(j["checkers"].size(), 2U);
+    EXPECT_EQ(j["checkers"][0]["checker"], "decision_diagram_simulation");
+    EXPECT_EQ(j["checkers"][1]["checker"], "decision_diagram_alternating");
+    EXPECT_TRUE(j["checkers"][1].contains("max_nodes"));
+
+    config.execution.retainCheckers = true;
+    ec::EquivalenceCheckingManager retaining(qc1, qc2, config);
+    retaining.run();
+    ASSERT_EQ(retaining.getCheckers().size(), 2U);
+    for (const auto& checker: retaining.getCheckers()) {
+        EXPECT_NE(checker, nullptr);
+    }
+    EXPECT_EQ(retaining.json()["checkers"].size(), 2U);
+}
+
+TEST_F(EqualityTest, ResumableChecker) {
+    qc1.import("./circuits/test/test_original.real");
+    qc2.import("./circuits/test/test_alternative.real");
+
+    ec::DDConstructionChecker checker(qc1, qc2, config);
+    std::size_t               slices = 1U;
+    while (!checker.resume(std::chrono::nanoseconds(1))) {
+        ++slices;
+    }
+    std::cout << "Finished after " << slices << " slices" << std::endl;
+    EXPECT_GT(slices, 1U);
+    EXPECT_EQ(checker.getEquivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    // the next call starts a new check
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(EqualityTest, InterleavedCheckers) {
+    qc1.import("./circuits/test/test_original.real");
+    qc2.import("./circuits/test/test_alternative.real");
+
+    config.execution.runReversibleChecker   = false;
+    config.execution.runSimulationChecker   = true;
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = true;
+    config.execution.parallel               = false;
+    config.execution.timeSlice              = 1ms;
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    qc2 = qc::QuantumComputation();
+    qc2.import("./circuits/test/test_erroneous.real");
+    ec::EquivalenceCheckingManager erroneous(qc1, qc2, config);
+    erroneous.run();
+    EXPECT_EQ(erroneous.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(EqualityTest, SharedComputeTable) {
+    qc1 = qc::QuantumComputation(3U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    qc1.x(2, 1_pc);
+    qc1.t(2);
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.h(0);
+    qc2.x(2, 1_pc);
+    qc2.x(1, 0_pc);
+    qc2.x(2, 0_pc);
+    qc2.t(2);
+
+    config.simulation.seed = 12345U;
+
+    // both checkers (with separate packages) simulate the same stimuli
+    auto                    table = std::make_shared<ec::SharedComputeTable>();
+    ec::StateGenerator      generator1(config.simulation.seed);
+    ec::StateGenerator      generator2(config.simulation.seed);
+    ec::DDSimulationChecker first(qc1, qc2, config);
+    ec::DDSimulationChecker second(qc1, qc2, config);
+    first.setSharedComputeTable(table);
+    second.setSharedComputeTable(table);
+    for (auto i = 0U; i < 4U; ++i) {
+        first.setRandomInitialState(generator1);
+        EXPECT_EQ(first.run(), ec::EquivalenceCriterion::Equivalent);
+        second.setRandomInitialState(generator2);
+        EXPECT_EQ(second.run(), ec::EquivalenceCriterion::Equivalent);
+
+        // the second checker reuses the gate applications of the first one
+        const auto v1 = first.getInternalVector2();
+        const auto v2 = second.getInternalVector2();
+        ASSERT_EQ(v1.size(), v2.size());
+        for (std::size_t j = 0U; j < v1.size(); ++j) {
+            EXPECT_NEAR(std::abs(v1[j] - v2[j]), 0., 1e-8);
+        }
+    }
+    EXPECT_GT(table->getCrossHits(), 0U);
+    EXPECT_LE(table->getCrossHits(), table->getHits());
+
+    // reused gate applications do not hide a differing relative phase
+    qc2.t(2);
+    config.simulation.sharedComputeTable   = true;
+    config.execution.runAlternatingChecker = false;
+    for (const auto parallel: {false, true}) {
+        config.execution.parallel = parallel;
+        ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+        ecm.run();
+        EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+        EXPECT_TRUE(ecm.json()["results"].contains("shared_compute_table"));
+    }
+}
+
+TEST_F(EqualityTest, CheckerBudgets) {
+    // simulating these circuits takes far longer than the simulation budget, while the alternating checker stays close to
+    // the identity (the second circuit realizes the CNOTs differently)
+    nqubits = 16U;
+    qc1     = qc::QuantumComputation(nqubits);
+    qc2     = qc::QuantumComputation(nqubits);
+    for (std::size_t layer = 0U; layer < 40U; ++layer) {
+        for (dd::QubitCount i = 0U; i < nqubits; ++i) {
+            qc1.h(static_cast<dd::Qubit>(i));
+            qc1.t(static_cast<dd::Qubit>(i));
+            qc2.h(static_cast<dd::Qubit>(i));
+            qc2.t(static_cast<dd::Qubit>(i));
+        }
+        for (dd::QubitCount i = (layer % 2U); i + 1U < nqubits; i += 2U) {
+            const auto control = static_cast<dd::Qubit>(i);
+            const auto target  = static_cast<dd::Qubit>(i + 1U);
+            qc1.x(target, dd::Control{control});
+            qc2.h(target);
+            qc2.z(target, dd::Control{control});
+            qc2.h(target);
+        }
+    }
+
+    config.execution.runReversibleChecker      = false;
+    config.execution.runPhasePolynomialChecker = false;
+    config.execution.runSimulationChecker      = true;
+    config.execution.runAlternatingChecker     = true;
+    config.execution.timeout                   = 60s;
+    config.execution.simulationBudget          = 1ms;
+
+    // the alternating checker proceeds once the simulations have used up their budget
+    for (const auto parallel: {false, true}) {
+        config.execution.parallel = parallel;
+        ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+        ecm.run();
+        std::cout << ecm << std::endl;
+        EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent) << "parallel: " << parallel;
+
+        const auto& exhausted = ecm.getResults().exhaustedBudgets;
+        EXPECT_EQ(std::count(exhausted.begin(), exhausted.end(), "total"), 0) << "parallel: " << parallel;
+        EXPECT_EQ(std::count(exhausted.begin(), exhausted.end(), "simulation"), 1) << "parallel: " << parallel;
+        EXPECT_LT(ecm.getResults().performedSimulations, ecm.getConfiguration().simulation.maxSims) << "parallel: " << parallel;
+    }
+}
+
+TEST_F(EqualityTest, TimeoutStopsSequentialCheckers) {
+    // a circuit that is far too large to be checked within the timeout. The second circuit realizes the CNOTs
+    // differently, so that no gates cancel right away
+    nqubits = 16U;
+    qc1     = qc::QuantumComputation(nqubits);
+    qc2     = qc::QuantumComputation(nqubits);
+    for (std::size_t layer = 0U; layer < 40U; ++layer) {
+        for (dd::QubitCount i = 0U; i < nqubits; ++i) {
+            qc1.h(static_cast<dd::Qubit>(i));
+            qc1.t(static_cast<dd::Qubit>(i));
+            qc2.h(static_cast<dd::Qubit>(i));
+            qc2.t(static_cast<dd::Qubit>(i));
+        }
+        for (dd::QubitCount i = (layer % 2U); i + 1U < nqubits; i += 2U) {
+            const auto control = static_cast<dd::Qubit>(i);
+            const auto target  = static_cast<dd::Qubit>(i + 1U);
+            qc1.x(target, dd::Control{control});
+            qc2.h(target);
+            qc2.z(target, dd::Control{control});
+            qc2.h(target);
+        }
+    }
+
+    config.execution.runReversibleChecker      = false;
+    config.execution.runPhasePolynomialChecker = false;
+    config.execution.parallel                  = false;
+    config.execution.timeout                   = 1ms;
+
+    for (const auto checker: {"simulation", "alternating", "construction"}) {
+        config.execution.runSimulationChecker   = std::string(checker) == "simulation";
+        config.execution.runAlternatingChecker  = std::string(checker) == "alternating";
+        config.execution.runConstructionChecker = std::string(checker) == "construction";
+
+        ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+        const auto                     start = std::chrono::steady_clock::now();
+        ecm.run();
+        const auto duration = std::chrono::steady_clock::now() - start;
+        std::cout << ecm << std::endl;
+
+        EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NoInformation) << checker;
+        const auto& exhausted = ecm.getResults().exhaustedBudgets;
+        EXPECT_EQ(std::count(exhausted.begin(), exhausted.end(), "total"), 1) << checker;
+        // the checker stops at the deadline instead of running to completion
+        EXPECT_LT(duration, 10s) << checker;
+    }
+}
+
+TEST_F(EqualityTest, NoTimeoutDoesNotStopCheckers) {
+    qc1.import("./circuits/test/test_original.real");
+    qc2.import("./circuits/test/test_alternative.real");
+
+    config.execution.runReversibleChecker      = false;
+    config.execution.runPhasePolynomialChecker = false;
+    config.execution.parallel                  = false;
+    config.execution.timeout                   = 0ms;
+
+    for (const auto checker: {"simulation", "alternating", "construction"}) {
+        config.execution.runSimulationChecker   = std::string(checker) == "simulation";
+        config.execution.runAlternatingChecker  = std::string(checker) == "alternating";
+        config.execution.runConstructionChecker = std::string(checker) == "construction";
+
+        ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+        ecm.run();
+        std::cout << ecm << std::endl;
+
+        const auto expected = std::string(checker) == "simulation" ? ec::EquivalenceCriterion::ProbablyEquivalent : ec::EquivalenceCriterion::Equivalent;
+        EXPECT_EQ(ecm.equivalence(), expected) << checker;
+        EXPECT_TRUE(ecm.getResults().exhaustedBudgets.empty()) << checker;
+    }
+}
+
+TEST_F(EqualityTest, MillisecondDurations) {
+    config.execution.timeout           = 250ms;
+    config.execution.alternatingBudget = 1500ms;
+
+    // durations are given in seconds
+    const auto j = config.json();
+    EXPECT_DOUBLE_EQ(j["execution"]["timeout"].get<double>(), 0.25);
+    EXPECT_DOUBLE_EQ(j["execution"]["alternating_budget"].get<double>(), 1.5);
+    EXPECT_FALSE(j["execution"].contains("simulation_budget"));
+
+    const auto parsed = ec::Configuration::fromJson(j);
+    EXPECT_EQ(parsed.execution.timeout, 250ms);
+    EXPECT_EQ(parsed.execution.alternatingBudget, 1500ms);
+    EXPECT_EQ(parsed.execution.simulationBudget, 0ms);
+}
@@ -0,0 +1,115 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+
+class OriginalCacheTest: public testing::Test {
+    void SetUp() override {
+        original.import("./circuits/test/test_original.real");
+        alternative.import("./circuits/test/test_alternative.real");
+        erroneous.import("./circuits/test/test_erroneous.real");
+
+        config.execution.parallel               = false;
+        config.execution.runAlternatingChecker  = false;
+        config.execution.runConstructionChecker = false;
+        config.execution.runSimulationChecker   = true;
+        config.simulation.maxSims               = 4U;
+        config.simulation.seed                  = 12345U;
+
+        cache = std::make_shared<ec::OriginalCache>();
+    }
+
+protected:
+    qc::QuantumComputation             original;
+    qc::QuantumComputation             alternative;
+    qc::QuantumComputation             erroneous;
+    ec::Configuration                  config{};
+    std::shared_ptr<ec::OriginalCache> cache{};
+
+    ec::EquivalenceCriterion check(const qc::QuantumComputation& compiled) {
+        ec::EquivalenceCheckingManager ecm(original, compiled, config);
+        ecm.setOriginalCache(cache);
+        ecm.run();
+        std::cout << ecm << std::endl;
+        return ecm.equivalence();
+    }
+};
+
+TEST_F(OriginalCacheTest, SimulationsReuseOutputStates) {
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(cache->getHits(), 0U);
+    EXPECT_EQ(cache->getMisses(), config.simulation.maxSims);
+
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(cache->getHits(), config.simulation.maxSims);
+
+    // the cached states still reveal the non-equivalence
+    EXPECT_EQ(check(erroneous), ec::EquivalenceCriterion::NotEquivalent);
+    EXPECT_GT(cache->getHits(), config.simulation.maxSims);
+}
+
+TEST_F(OriginalCacheTest, ParallelSimulationsReuseOutputStates) {
+    config.execution.parallel = true;
+    config.execution.nthreads = 2U;
+
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(cache->getHits(), config.simulation.maxSims);
+}
+
+TEST_F(OriginalCacheTest, ConstructionReusesFunctionality) {
+    config.execution.runSimulationChecker   = false;
+    config.execution.runConstructionChecker = true;
+
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::Equivalent);
+    EXPECT_EQ(check(alternative), ec::EquivalenceCriterion::Equivalent);
+    EXPECT_EQ(cache->getHits(), 1U);
+
+    EXPECT_EQ(check(erroneous), ec::EquivalenceCriterion::NotEquivalent);
+    EXPECT_EQ(cache->getHits(), 2U);
+}
+
+TEST_F(OriginalCacheTest, RandomSeedIsNotCached) {
+    config.simulation.seed = 0U;
+
+    check(alternative);
+    check(alternative);
+    EXPECT_EQ(cache->getHits(), 0U);
+    EXPECT_EQ(cache->getMisses(), 0U);
+}
+
+TEST_F(OriginalCacheTest, SmallerCandidateWithAncillae) {
+    using namespace dd::literals;
+
+    // the controlled operation at the beginning is only trivial if the last qubit starts in |0>
+    original = qc::QuantumComputation(3U);
+    original.x(0, 2_pc);
+    original.h(0);
+    original.x(1, 0_pc);
+    original.t(1);
+    original.x(1);
+    original.x(1);
+
+    // a candidate with fewer gates than the original, in which the last qubit is ancillary. Its stimuli are generated
+    // with the ancillary qubit in |0>
+    auto candidate = qc::QuantumComputation(3U);
+    candidate.h(0);
+    candidate.x(1, 0_pc);
+    candidate.t(1);
+    candidate.z(2);
+    candidate.setLogicalQubitAncillary(2);
+    EXPECT_EQ(check(candidate), ec::EquivalenceCriterion::ProbablyEquivalent);
+
+    // a candidate with more gates than the original and without ancillary qubits. Its stimuli cover all qubits, so that
+    // the output states cached for the previous candidate must not be reused
+    auto larger = original.clone();
+    larger.x(2);
+    larger.x(2);
+    const auto hits = cache->getHits();
+    EXPECT_EQ(check(larger), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(cache->getHits(), hits);
+}
@@ -0,0 +1,132 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+#include "parameterized/SymbolicOperation.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace dd::literals;
+
+class ParameterizedTest: public testing::Test {
+    void SetUp() override {
+        qc1 = qc::QuantumComputation(nqubits);
+        qc2 = qc::QuantumComputation(nqubits);
+
+        config.optimizations.reorderOperations = false;
+        config.simulation.seed                 = 12345U;
+    }
+
+protected:
+    dd::QubitCount         nqubits = 2U;
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+
+    const ec::SymbolicExpression theta{"theta"};
+    const ec::SymbolicExpression phi{"phi"};
+};
+
+TEST_F(ParameterizedTest, ExpressionArithmetic) {
+    const auto expr = 2. * theta + phi - theta + 0.5;
+    EXPECT_FALSE(expr.isConstant());
+    EXPECT_EQ(expr.getVariables().size(), 2U);
+    EXPECT_DOUBLE_EQ(expr.evaluate({{"theta", 1.}, {"phi", 2.}}), 3.5);
+    EXPECT_EQ(expr - phi - theta, ec::SymbolicExpression{0.5});
+    EXPECT_TRUE((expr - phi - theta).isConstant());
+    EXPECT_THROW(static_cast<void>(expr.evaluate({{"theta", 1.}})), std::runtime_error);
+}
+
+TEST_F(ParameterizedTest, UnsupportedGate) {
+    EXPECT_THROW(qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::H, theta), std::invalid_argument);
+}
+
+TEST_F(ParameterizedTest, SymbolicCancellation) {
+    qc1.h(0);
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, theta);
+    qc1.x(1, 0_pc);
+
+    qc2.h(0);
+    qc2.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, theta);
+    qc2.x(1, 0_pc);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    EXPECT_TRUE(ecm.isParameterized());
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+    EXPECT_EQ(ecm.getResults().performedInstantiations, 1U);
+}
+
+TEST_F(ParameterizedTest, MergedRotations) {
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RX, theta / 2.);
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RX, theta / 2. + phi);
+
+    qc2.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RX, phi + theta);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+    EXPECT_EQ(ecm.getResults().performedInstantiations, 1U);
+}
+
+TEST_F(ParameterizedTest, VariablesCancelOut) {
+    qc1.h(0);
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, theta);
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, -theta);
+
+    qc2.h(0);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+    EXPECT_EQ(ecm.getResults().performedInstantiations, 1U);
+}
+
+TEST_F(ParameterizedTest, RandomInstantiations) {
+    // both circuits are equivalent since a diagonal gate on the control commutes with the CNOT,
+    // but this cannot be concluded by symbolic cancellation
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, theta);
+    qc1.x(1, 0_pc);
+
+    qc2.x(1, 0_pc);
+    qc2.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RZ, theta);
+
+    config.parameterized.nInstantiations = 4U;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::ProbablyEquivalent);
+    EXPECT_EQ(ecm.getResults().performedInstantiations, 4U);
+}
+
+TEST_F(ParameterizedTest, NotEquivalent) {
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RY, theta);
+    qc1.x(1, 0_pc);
+
+    qc2.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::RY, 2. * theta);
+    qc2.x(1, 0_pc);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(ParameterizedTest, PhaseWithSpecialConstant) {
+    // a constant part of 0 must not turn the phase gate into an identity gate
+    qc1.h(0);
+    qc1.emplace_back<ec::SymbolicOperation>(nqubits, 0, qc::Phase, theta);
+    EXPECT_EQ(qc1.back()->getType(), qc::Phase);
+
+    qc2.h(0);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
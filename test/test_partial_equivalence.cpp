@@ -0,0 +1,108 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace dd::literals;
+
+class PartialEquivalenceTest: public testing::Test {
+    void SetUp() override {
+        qc1 = qc::QuantumComputation(nqubits);
+        qc2 = qc::QuantumComputation(nqubits);
+
+        config.optimizations.reorderOperations = false;
+        config.simulation.seed                 = 12345U;
+    }
+
+protected:
+    dd::QubitCount         nqubits = 2U;
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+};
+
+TEST_F(PartialEquivalenceTest, IrrelevantOutputDiffers) {
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+
+    qc2.h(0);
+    qc2.x(1);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+
+    config.partialEquivalence.relevantOutputs = {0};
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_TRUE(ecm2.getResults().consideredEquivalent());
+}
+
+TEST_F(PartialEquivalenceTest, RelevantOutputDiffers) {
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+
+    qc2.h(0);
+    qc2.z(0);
+    qc2.x(1);
+
+    config.partialEquivalence.relevantOutputs = {0};
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(PartialEquivalenceTest, InvalidRelevantOutput) {
+    qc1.x(0);
+    qc2.x(0);
+
+    config.partialEquivalence.relevantOutputs = {2};
+    EXPECT_THROW(ec::EquivalenceCheckingManager(qc1, qc2, config), std::invalid_argument);
+}
+
+TEST_F(PartialEquivalenceTest, EarlyGarbageReduction) {
+    // the irrelevant qubit is no longer acted upon after the first gate in both circuits
+    qc1 = qc::QuantumComputation(3U);
+    qc1.x(2, 0_pc);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+
+    qc2 = qc::QuantumComputation(3U);
+    qc2.x(2);
+    qc2.h(0);
+    qc2.x(1, 0_pc);
+
+    config.partialEquivalence.relevantOutputs = {0, 1};
+    config.execution.runSimulationChecker     = false;
+    config.execution.runAlternatingChecker    = false;
+    config.execution.runConstructionChecker   = true;
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+
+    config.execution.runAlternatingChecker  = true;
+    config.execution.runConstructionChecker = false;
+    ec::EquivalenceCheckingManager ecm2(qc1, qc2, config);
+    ecm2.run();
+    std::cout << ecm2 << std::endl;
+    EXPECT_TRUE(ecm2.getResults().consideredEquivalent());
+}
+
+TEST_F(PartialEquivalenceTest, RelevantOutputsFromJsonReplaceDefaults) {
+    config.partialEquivalence.relevantOutputs = {0, 1};
+
+    nlohmann::json j{};
+    j["partial_equivalence"]["relevant_outputs"] = {1};
+    const auto parsed                            = ec::Configuration::fromJson(j, config);
+    EXPECT_EQ(parsed.partialEquivalence.relevantOutputs, std::vector<dd::Qubit>{1});
+
+    // the defaults are kept if no outputs are given
+    EXPECT_EQ(ec::Configuration::fromJson(nlohmann::json::object(), config).partialEquivalence.relevantOutputs, config.partialEquivalence.relevantOutputs);
+}
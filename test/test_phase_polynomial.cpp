@@ -0,0 +1,100 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace dd::literals;
+
+class PhasePolynomialTest: public testing::Test {
+    void SetUp() override {
+        qc1 = qc::QuantumComputation(nqubits);
+        qc2 = qc::QuantumComputation(nqubits);
+
+        config.optimizations.reorderOperations = false;
+        config.simulation.seed                 = 12345U;
+    }
+
+protected:
+    dd::QubitCount         nqubits = 2U;
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+};
+
+TEST_F(PhasePolynomialTest, ControlledSDecomposition) {
+    qc1.s(1, {0_pc});
+
+    qc2.t(0);
+    qc2.t(1);
+    qc2.x(1, 0_pc);
+    qc2.tdag(1);
+    qc2.x(1, 0_pc);
+
+    EXPECT_TRUE(ec::PhasePolynomialChecker::isApplicable(qc1));
+    EXPECT_TRUE(ec::PhasePolynomialChecker::isApplicable(qc2));
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    const auto j = ecm.json();
+    ASSERT_EQ(j["checkers"].size(), 1U);
+    EXPECT_EQ(j["checkers"][0]["checker"], "phase_polynomial");
+}
+
+TEST_F(PhasePolynomialTest, ParityPhasesCancel) {
+    // the phases pi*x0, pi*(x0 xor x1), and pi*x1 cancel although none of the parities is the same
+    qc1.x(1, 0_pc);
+    qc1.z(0);
+    qc1.z(1);
+    qc1.x(1, 0_pc);
+    qc1.z(1);
+    qc1.x(1, 0_pc);
+
+    qc2.x(1, 0_pc);
+
+    ec::PhasePolynomialChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(PhasePolynomialTest, GlobalPhase) {
+    qc1.rz(0, dd::PI);
+    qc1.x(1, 0_pc);
+
+    qc2.z(0);
+    qc2.x(1, 0_pc);
+
+    ec::PhasePolynomialChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::EquivalentUpToGlobalPhase);
+}
+
+TEST_F(PhasePolynomialTest, DifferentPhases) {
+    qc1.t(0);
+    qc1.x(1, 0_pc);
+
+    qc2.tdag(0);
+    qc2.x(1, 0_pc);
+
+    ec::PhasePolynomialChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NotEquivalent);
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::NotEquivalent);
+}
+
+TEST_F(PhasePolynomialTest, DifferentLinearParts) {
+    qc1.x(1, 0_pc);
+    qc1.t(1);
+
+    qc2.x(0, 1_pc);
+    qc2.t(1);
+
+    ec::PhasePolynomialChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NotEquivalent);
+}
@@ -0,0 +1,83 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <tuple>
+
+class PreprocessedPairTest: public testing::Test {
+    void SetUp() override {
+        qc1.import("./circuits/test/test.real");
+        qc2.import("./circuits/test/test_alternative.real");
+
+        config.simulation.seed = 12345U;
+    }
+
+protected:
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+};
+
+TEST_F(PreprocessedPairTest, RoundTrip) {
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    const auto                     preprocessed = ecm.getPreprocessedPair();
+    const auto                     data         = preprocessed.serialize();
+
+    const auto pair = ec::PreprocessedPair::read(data.data(), data.size());
+    EXPECT_EQ(pair.qc1.getNops(), preprocessed.qc1.getNops());
+    EXPECT_EQ(pair.qc2.getNqubits(), preprocessed.qc2.getNqubits());
+    EXPECT_EQ(pair.qc2.initialLayout, preprocessed.qc2.initialLayout);
+    EXPECT_EQ(pair.qc2.outputPermutation, preprocessed.qc2.outputPermutation);
+    EXPECT_EQ(pair.qc2.garbage, preprocessed.qc2.garbage);
+
+    // the same data results from serializing the read pair again
+    EXPECT_EQ(pair.serialize(), data);
+
+    ecm.run();
+    ec::EquivalenceCheckingManager restored(ec::PreprocessedPair::read(data.data(), data.size()), config);
+    restored.run();
+    std::cout << restored << std::endl;
+    EXPECT_EQ(restored.equivalence(), ecm.equivalence());
+}
+
+TEST_F(PreprocessedPairTest, CheckWithDifferentConfigurations) {
+    config.optimizations.fixOutputPermutationMismatch = true;
+    const auto filename                               = "preprocessed_pair.qcec";
+    ec::EquivalenceCheckingManager(qc1, qc2, config).getPreprocessedPair().write(filename);
+
+    for (const auto& [simulation, alternating, construction]: {std::tuple{true, false, false}, std::tuple{false, true, false}, std::tuple{false, false, true}}) {
+        ec::Configuration configuration{};
+        configuration.execution.runSimulationChecker   = simulation;
+        configuration.execution.runAlternatingChecker  = alternating;
+        configuration.execution.runConstructionChecker = construction;
+
+        ec::EquivalenceCheckingManager ecm(ec::PreprocessedPair::read(std::string(filename)), configuration);
+        // the optimizations used during preprocessing are reported
+        EXPECT_TRUE(ecm.getConfiguration().optimizations.fixOutputPermutationMismatch);
+        ecm.run();
+        std::cout << ecm << std::endl;
+        EXPECT_TRUE(ecm.getResults().consideredEquivalent());
+    }
+    std::remove(filename);
+}
+
+TEST_F(PreprocessedPairTest, InvalidData) {
+    auto data = ec::EquivalenceCheckingManager(qc1, qc2, config).getPreprocessedPair().serialize();
+
+    // truncated data
+    EXPECT_THROW(static_cast<void>(ec::PreprocessedPair::read(data.data(), data.size() / 2U)), std::runtime_error);
+
+    // unsupported version
+    data[8] = static_cast<char>(ec::PreprocessedPair::VERSION + 1U);
+    EXPECT_THROW(static_cast<void>(ec::PreprocessedPair::read(data.data(), data.size())), std::runtime_error);
+
+    // not a preprocessed pair at all
+    const std::string garbage = "OPENQASM 2.0;";
+    EXPECT_THROW(static_cast<void>(ec::PreprocessedPair::read(garbage.data(), garbage.size())), std::runtime_error);
+}
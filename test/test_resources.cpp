@@ -0,0 +1,89 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "Configuration.hpp"
+#include "EquivalenceCheckingManager.hpp"
+#include "Resources.hpp"
+
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class ResourcesTest: public testing::Test {
+    void SetUp() override {
+        root = fs::temp_directory_path() / ("qcec_cgroup_" + std::to_string(std::hash<std::string>{}(testing::UnitTest::GetInstance()->current_test_info()->name())));
+        fs::remove_all(root);
+        fs::create_directories(root);
+    }
+
+    void TearDown() override {
+        fs::remove_all(root);
+    }
+
+protected:
+    fs::path root{};
+
+    void write(const fs::path& file, const std::string& content) const {
+        fs::create_directories((root / file).parent_path());
+        std::ofstream ofs(root / file);
+        ofs << content << "\n";
+    }
+};
+
+TEST_F(ResourcesTest, UnifiedHierarchy) {
+    write("cpu.max", "400000 100000");
+    write("memory.max", "1073741824");
+
+    const auto resources = ec::Resources::detect(root.string());
+    ASSERT_TRUE(resources.cpuQuota.has_value());
+    EXPECT_DOUBLE_EQ(*resources.cpuQuota, 4.);
+    ASSERT_TRUE(resources.memoryLimit.has_value());
+    EXPECT_EQ(*resources.memoryLimit, 1073741824U);
+    EXPECT_LE(resources.threads(), 4U);
+    EXPECT_GE(resources.threads(4U), 1U);
+
+    const auto j = resources.json();
+    EXPECT_EQ(j["cpu_quota"], 4.);
+    EXPECT_EQ(j["memory_limit"], 1073741824U);
+}
+
+TEST_F(ResourcesTest, Unlimited) {
+    write("cpu.max", "max 100000");
+    write("memory.max", "max");
+
+    const auto resources = ec::Resources::detect(root.string());
+    EXPECT_FALSE(resources.cpuQuota.has_value());
+    EXPECT_FALSE(resources.memoryLimit.has_value());
+    EXPECT_EQ(resources.threads(), resources.hardwareThreads);
+}
+
+TEST_F(ResourcesTest, LegacyHierarchy) {
+    write("cpu,cpuacct/cpu.cfs_quota_us", "150000");
+    write("cpu,cpuacct/cpu.cfs_period_us", "100000");
+    write("memory/memory.limit_in_bytes", "9223372036854771712");
+
+    const auto resources = ec::Resources::detect(root.string());
+    ASSERT_TRUE(resources.cpuQuota.has_value());
+    EXPECT_DOUBLE_EQ(*resources.cpuQuota, 1.5);
+    EXPECT_FALSE(resources.memoryLimit.has_value());
+    EXPECT_LE(resources.threads(), 2U);
+}
+
+TEST_F(ResourcesTest, ReportedWithResults) {
+    // serialized configurations do not depend on the machine they have been created on
+    const auto config = ec::Configuration{}.json();
+    EXPECT_FALSE(config.contains("resources"));
+    EXPECT_LE(ec::Configuration{}.execution.nthreads, std::max<std::size_t>(2U, ec::Resources::get().hardwareThreads));
+
+    auto qc = qc::QuantumComputation(1U);
+    qc.x(0);
+    ec::EquivalenceCheckingManager ecm(qc, qc, ec::Configuration{});
+    ecm.run();
+    const auto j = ecm.json();
+    ASSERT_TRUE(j.contains("resources"));
+    EXPECT_EQ(j["resources"]["threads"], ec::Resources::get().threads());
+}
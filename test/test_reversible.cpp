@@ -0,0 +1,98 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#include "EquivalenceCheckingManager.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace dd::literals;
+
+class ReversibleTest: public testing::Test {
+    void SetUp() override {
+        qc1 = qc::QuantumComputation(nqubits);
+        qc2 = qc::QuantumComputation(nqubits);
+
+        config.optimizations.reorderOperations = false;
+        config.simulation.seed                 = 12345U;
+    }
+
+protected:
+    dd::QubitCount         nqubits = 3U;
+    qc::QuantumComputation qc1;
+    qc::QuantumComputation qc2;
+    ec::Configuration      config{};
+};
+
+TEST_F(ReversibleTest, FredkinDecomposition) {
+    qc1.swap(1, 2, {0_pc});
+
+    qc2.x(1, 2_pc);
+    qc2.x(2, {0_pc, 1_pc});
+    qc2.x(1, 2_pc);
+
+    EXPECT_TRUE(ec::ReversibleChecker::isReversible(qc1));
+    EXPECT_TRUE(ec::ReversibleChecker::isReversible(qc2));
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    std::cout << ecm << std::endl;
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+
+    const auto j = ecm.json();
+    ASSERT_EQ(j["checkers"].size(), 1U);
+    EXPECT_EQ(j["checkers"][0]["checker"], "reversible");
+    EXPECT_EQ(j["checkers"][0]["checked_stimuli"], 8U);
+}
+
+TEST_F(ReversibleTest, NegativeControlDiffers) {
+    qc1.x(2, {0_pc, 1_pc});
+    qc2.x(2, {0_pc, 1_nc});
+
+    ec::ReversibleChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::NotEquivalent);
+
+    // both circuits only differ for q1 = 0 and q0 = 1
+    const auto& counterexample = checker.getCounterexample();
+    ASSERT_EQ(counterexample.size(), nqubits);
+    EXPECT_EQ(counterexample[2], '1');
+    EXPECT_EQ(counterexample[1], '0');
+}
+
+TEST_F(ReversibleTest, RandomStimuliAreNotConclusive) {
+    qc1.x(1, 0_pc);
+    qc1.x(2, 1_pc);
+
+    qc2.x(2, 1_pc);
+    qc2.x(2, 0_pc);
+    qc2.x(1, 0_pc);
+
+    config.reversible.maxExhaustiveInputs = 2U;
+    config.reversible.nRandomStimuli      = 1024U;
+
+    ec::ReversibleChecker checker(qc1, qc2, config);
+    EXPECT_EQ(checker.run(), ec::EquivalenceCriterion::ProbablyEquivalent);
+
+    // the decision diagram-based checkers still prove the equivalence
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+}
+
+TEST_F(ReversibleTest, NonReversibleCircuitsAreSkipped) {
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+
+    qc2.h(0);
+    qc2.x(1, 0_pc);
+
+    EXPECT_FALSE(ec::ReversibleChecker::isReversible(qc1));
+
+    ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+    ecm.run();
+    EXPECT_EQ(ecm.equivalence(), ec::EquivalenceCriterion::Equivalent);
+    for (const auto& checker: ecm.json()["checkers"]) {
+        EXPECT_NE(checker["checker"], "reversible");
+    }
+}
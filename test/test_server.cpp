@@ -0,0 +1,210 @@
+/*
+* This file is part of MQT QCEC library which is released under the MIT license.
+* See file README.md or go to https://www.cda.cit.tum.de/research/quantum_verification/ for more information.
+*/
+
+#ifndef _WIN32
+#include "EquivalenceCheckingManager.hpp"
+#include "Server.hpp"
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+using namespace dd::literals;
+
+class ServerTest: public testing::Test {
+    void SetUp() override {
+        socketPath = (fs::temp_directory_path() / ("qcec_server_" + std::to_string(::getpid()) + ".sock")).string();
+
+        ec::Configuration config{};
+        config.execution.parallel = false;
+
+        ec::Server::Options options{};
+        options.socketPath     = socketPath;
+        options.nthreads       = 2U;
+        options.maxRequestSize = 1U << 16U;
+        server                 = std::make_unique<ec::Server>(options, config);
+        thread             = std::thread([this] { server->run(); });
+
+        connect();
+    }
+
+    void TearDown() override {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        server->stop();
+        thread.join();
+        EXPECT_FALSE(fs::exists(socketPath));
+    }
+
+protected:
+    std::string                 socketPath{};
+    std::unique_ptr<ec::Server> server{};
+    std::thread                 thread{};
+    int                         fd = -1;
+    std::string                 buffer{};
+
+    // the server might not be listening yet
+    void connect() {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        socketPath.copy(address.sun_path, socketPath.size());
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            ASSERT_GE(fd, 0);
+            if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                return;
+            }
+            ::close(fd);
+            fd = -1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        FAIL() << "Could not connect to " << socketPath;
+    }
+
+    void send(const std::string& line) const {
+        const auto message = line + "\n";
+        ASSERT_EQ(::send(fd, message.data(), message.size(), 0), static_cast<ssize_t>(message.size()));
+    }
+
+    nlohmann::json receive() {
+        char chunk[4096];
+        while (buffer.find('\n') == std::string::npos) {
+            const auto n = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                ADD_FAILURE() << "Connection closed by the server";
+                return {};
+            }
+            buffer.append(chunk, static_cast<std::size_t>(n));
+        }
+        const auto pos  = buffer.find('\n');
+        const auto line = buffer.substr(0U, pos);
+        buffer.erase(0U, pos + 1U);
+        return nlohmann::json::parse(line);
+    }
+};
+
+TEST_F(ServerTest, RoundTrip) {
+    nlohmann::json request{};
+    request["id"]       = 1;
+    request["circuit1"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[2];\nh q[0];\ncx q[0],q[1];\n";
+    request["circuit2"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[2];\nh q[0];\nh q[1];\ncz q[0],q[1];\nh q[1];\n";
+    send(request.dump());
+
+    const auto response = receive();
+    EXPECT_FALSE(response.contains("error")) << response.dump();
+    EXPECT_EQ(response["id"], 1);
+    EXPECT_EQ(response["cached"], false);
+    EXPECT_EQ(response["results"]["equivalence"], "equivalent");
+
+    // an identical request (apart from its id) is answered from the cache
+    request["id"] = "second";
+    send(request.dump());
+    const auto cached = receive();
+    EXPECT_EQ(cached["id"], "second");
+    EXPECT_EQ(cached["cached"], true);
+    EXPECT_EQ(cached["results"], response["results"]);
+}
+
+TEST_F(ServerTest, MalformedRequests) {
+    // the request is not valid JSON
+    send("{\"id\": 1, \"circuit1\": ");
+    const auto invalid = receive();
+    ASSERT_TRUE(invalid.contains("error"));
+    EXPECT_EQ(invalid["error"].get<std::string>().rfind("Malformed request", 0), 0U);
+
+    // the request lacks the second circuit
+    send(R"({"id": 2, "circuit1": "OPENQASM 2.0;\nqreg q[1];\n"})");
+    const auto incomplete = receive();
+    EXPECT_EQ(incomplete["id"], 2);
+    EXPECT_TRUE(incomplete.contains("error"));
+
+    // the circuit format is unknown
+    send(R"({"id": 3, "circuit1": "OPENQASM 2.0;\nqreg q[1];\n", "circuit2": "OPENQASM 2.0;\nqreg q[1];\n", "format": "unknown"})");
+    const auto unparsable = receive();
+    EXPECT_EQ(unparsable["id"], 3);
+    EXPECT_TRUE(unparsable.contains("error"));
+    EXPECT_EQ(unparsable["cached"], false);
+
+    // the connection stays usable after malformed requests
+    nlohmann::json request{};
+    request["id"]       = 4;
+    request["circuit1"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[1];\nx q[0];\n";
+    request["circuit2"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[1];\nz q[0];\n";
+    send(request.dump());
+    const auto valid = receive();
+    EXPECT_EQ(valid["id"], 4);
+    EXPECT_FALSE(valid.contains("error")) << valid.dump();
+    EXPECT_EQ(valid["results"]["equivalence"], "not_equivalent");
+}
+
+TEST_F(ServerTest, OverlongRequests) {
+    // a line that exceeds the maximum size is rejected without being buffered completely
+    send(std::string(1U << 18U, 'x'));
+    const auto rejected = receive();
+    ASSERT_TRUE(rejected.contains("error"));
+    EXPECT_NE(rejected["error"].get<std::string>().find("maximum size"), std::string::npos);
+
+    // the connection stays usable afterwards
+    nlohmann::json request{};
+    request["id"]       = 1;
+    request["circuit1"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[1];\nx q[0];\n";
+    request["circuit2"] = "OPENQASM 2.0;\ninclude \"qelib1.inc\";\nqreg q[1];\nx q[0];\n";
+    send(request.dump());
+    const auto valid = receive();
+    EXPECT_EQ(valid["id"], 1);
+    EXPECT_FALSE(valid.contains("error")) << valid.dump();
+    EXPECT_EQ(valid["results"]["equivalence"], "equivalent");
+}
+
+TEST_F(ServerTest, PreprocessedPairPayload) {
+    auto qc1 = qc::QuantumComputation(2U);
+    qc1.h(0);
+    qc1.x(1, 0_pc);
+    auto qc2 = qc::QuantumComputation(2U);
+    qc2.h(0);
+    qc2.h(1);
+    qc2.z(1, 0_pc);
+    qc2.h(1);
+
+    ec::Configuration config{};
+    config.execution.parallel = false;
+    const ec::EquivalenceCheckingManager ecm(qc1, qc2, config);
+
+    nlohmann::json request{};
+    request["id"]   = "pair";
+    request["pair"] = ec::base64Encode(ecm.getPreprocessedPair().serialize());
+    send(request.dump());
+    const auto response = receive();
+    EXPECT_EQ(response["id"], "pair");
+    EXPECT_FALSE(response.contains("error")) << response.dump();
+    EXPECT_EQ(response["results"]["equivalence"], "equivalent");
+
+    // payloads that are no valid base64 encoding of a pair are reported as errors
+    request["pair"] = "not base64";
+    send(request.dump());
+    EXPECT_TRUE(receive().contains("error"));
+    request["pair"] = ec::base64Encode("QCECPAIR");
+    send(request.dump());
+    EXPECT_TRUE(receive().contains("error"));
+}
+
+TEST(Base64Test, RoundTrip) {
+    for (const auto& data: {std::string{}, std::string("f"), std::string("fo"), std::string("foo"), std::string("foob"), std::string("\0\xff\x80", 3U)}) {
+        EXPECT_EQ(ec::base64Decode(ec::base64Encode(data)), data);
+    }
+    EXPECT_EQ(ec::base64Encode("foobar"), "Zm9vYmFy");
+    EXPECT_EQ(ec::base64Encode("fooba"), "Zm9vYmE=");
+    EXPECT_THROW(const auto decoded = ec::base64Decode("Zm9"), std::invalid_argument);
+    EXPECT_THROW(const auto decoded = ec::base64Decode("Zm=v"), std::invalid_argument);
+}
+#endif